@@ -0,0 +1,264 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "rng90/async.h"
+#include "rng90_log.h"
+
+#define DEVICE_BLOCK_SIZE 32
+
+// Interval between checks for the wake response, power up takes 1.0-1.8 ms.
+#define WAKE_FIRST_POLL_US 1000
+#define WAKE_POLL_INTERVAL_US 100
+
+// Internal Function Definitions
+static void start_work(async_context_t* context, async_when_pending_worker_t* start_worker);
+static void timer_work(async_context_t* context, async_at_time_worker_t* timer_worker);
+static void issue_next(rng90_async_t* worker);
+static void complete(rng90_async_t* worker, bool success);
+static void refill_done(rng90_async_t* worker, bool success, void* user_data);
+
+bool rng90_async_init(rng90_async_t* worker, async_context_t* context, rng90_context_t* ctx)
+{
+    worker->ctx = ctx;
+    worker->context = context;
+    worker->state = RNG90_ASYNC_IDLE;
+    worker->buf = NULL;
+    worker->len = 0;
+    worker->offset = 0;
+    worker->callback = NULL;
+    worker->user_data = NULL;
+    worker->pool = NULL;
+    worker->refill_block = NULL;
+    worker->refill_pool = NULL;
+    worker->queued = false;
+
+    worker->start_worker.do_work = start_work;
+    worker->start_worker.work_pending = false;
+    worker->start_worker.user_data = worker;
+    worker->timer_worker.do_work = timer_work;
+    worker->timer_worker.user_data = worker;
+
+    return async_context_add_when_pending_worker(context, &worker->start_worker);
+}
+
+void rng90_async_deinit(rng90_async_t* worker)
+{
+    async_context_remove_at_time_worker(worker->context, &worker->timer_worker);
+    async_context_remove_when_pending_worker(worker->context, &worker->start_worker);
+    if (worker->refill_block)
+    {
+        rng90_pool_end_fill(worker->refill_pool, worker->refill_block, false);
+        worker->refill_block = NULL;
+        worker->refill_pool = NULL;
+    }
+    worker->queued = false;
+    worker->state = RNG90_ASYNC_IDLE;
+}
+
+bool rng90_async_random(rng90_async_t* worker, uint8_t* buf, size_t len,
+    rng90_async_callback_t callback, void* user_data)
+{
+    if (worker->state != RNG90_ASYNC_IDLE)
+    {
+        // A background refill is at most one block, the request follows it.
+        if (!worker->refill_block || worker->queued)
+        {
+            return false;
+        }
+
+        worker->queued = true;
+        worker->queued_buf = buf;
+        worker->queued_len = len;
+        worker->queued_callback = callback;
+        worker->queued_user_data = user_data;
+        return true;
+    }
+
+    worker->buf = buf;
+    worker->len = len;
+    worker->offset = 0;
+    worker->callback = callback;
+    worker->user_data = user_data;
+    worker->state = RNG90_ASYNC_STARTING;
+
+    async_context_set_work_pending(worker->context, &worker->start_worker);
+    return true;
+}
+
+void rng90_async_set_pool(rng90_async_t* worker, rng90_pool_t* pool)
+{
+    worker->pool = pool;
+}
+
+void rng90_async_kick(rng90_async_t* worker)
+{
+    async_context_set_work_pending(worker->context, &worker->start_worker);
+}
+
+bool rng90_async_is_busy(rng90_async_t* worker)
+{
+    return worker->state != RNG90_ASYNC_IDLE;
+}
+
+// Internal function implementations
+
+static void start_work(async_context_t* context, async_when_pending_worker_t* start_worker)
+{
+    rng90_async_t* worker = (rng90_async_t*)start_worker->user_data;
+
+    // Nothing is pending on the device while idle, so the sleep is a single short write.
+    if (worker->state == RNG90_ASYNC_IDLE && worker->pool && !worker->ctx->random_pending &&
+        rng90_pool_take_sleep_request(worker->pool))
+    {
+        rng90_sleep(worker->ctx);
+    }
+
+    if (worker->state == RNG90_ASYNC_IDLE && worker->pool && rng90_pool_needs_refill(worker->pool))
+    {
+        uint8_t* block = rng90_pool_begin_fill(worker->pool);
+        if (block)
+        {
+            worker->refill_block = block;
+            worker->refill_pool = worker->pool;
+            worker->buf = block;
+            worker->len = RNG90_POOL_BLOCK_SIZE;
+            worker->offset = 0;
+            worker->callback = refill_done;
+            worker->user_data = NULL;
+            worker->state = RNG90_ASYNC_STARTING;
+        }
+    }
+
+    if (worker->state != RNG90_ASYNC_STARTING)
+    {
+        return;
+    }
+
+    if (rng90_is_sleeping(worker->ctx))
+    {
+        rng90_wake_start(worker->ctx);
+        worker->state = RNG90_ASYNC_WAKING;
+        async_context_add_at_time_worker_in_us(context, &worker->timer_worker, WAKE_FIRST_POLL_US);
+        return;
+    }
+
+    issue_next(worker);
+}
+
+static void timer_work(async_context_t* context, async_at_time_worker_t* timer_worker)
+{
+    rng90_async_t* worker = (rng90_async_t*)timer_worker->user_data;
+
+    switch (worker->state)
+    {
+        case RNG90_ASYNC_WAKING:
+        {
+            rng90_wake_status_t status = rng90_wake_poll(worker->ctx);
+            if (status == RNG90_WAKE_PENDING)
+            {
+                async_context_add_at_time_worker_in_us(context, &worker->timer_worker, WAKE_POLL_INTERVAL_US);
+            }
+            else if (status == RNG90_WAKE_DONE)
+            {
+                issue_next(worker);
+            }
+            else
+            {
+                complete(worker, false);
+            }
+            break;
+        }
+        case RNG90_ASYNC_RANDOM:
+        {
+            if (!rng90_random_finish(worker->ctx, &worker->buf[worker->offset], worker->len - worker->offset))
+            {
+                complete(worker, false);
+                break;
+            }
+
+            size_t remaining = worker->len - worker->offset;
+            worker->offset += remaining < DEVICE_BLOCK_SIZE ? remaining : DEVICE_BLOCK_SIZE;
+            issue_next(worker);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+static void issue_next(rng90_async_t* worker)
+{
+    if (worker->offset >= worker->len)
+    {
+        complete(worker, true);
+        return;
+    }
+
+    if (!rng90_random_start(worker->ctx))
+    {
+        complete(worker, false);
+        return;
+    }
+
+    worker->state = RNG90_ASYNC_RANDOM;
+    async_context_add_at_time_worker_at(worker->context, &worker->timer_worker,
+        rng90_random_ready_at(worker->ctx));
+}
+
+static void complete(rng90_async_t* worker, bool success)
+{
+    if (!success)
+    {
+        rng90_log(worker->ctx, "RNG90 async request failed after %u bytes\n", (unsigned)worker->offset);
+    }
+
+    worker->state = RNG90_ASYNC_IDLE;
+    if (worker->callback)
+    {
+        worker->callback(worker, success, worker->user_data);
+    }
+}
+
+static void refill_done(rng90_async_t* worker, bool success, void* user_data)
+{
+    (void)user_data;
+
+    // The slot goes back to the pool it came from even if the pool has since been changed.
+    uint8_t* block = worker->refill_block;
+    rng90_pool_t* pool = worker->refill_pool;
+    worker->refill_block = NULL;
+    worker->refill_pool = NULL;
+    rng90_pool_end_fill(pool, block, success);
+
+    if (worker->queued)
+    {
+        worker->queued = false;
+        worker->buf = worker->queued_buf;
+        worker->len = worker->queued_len;
+        worker->offset = 0;
+        worker->callback = worker->queued_callback;
+        worker->user_data = worker->queued_user_data;
+        worker->state = RNG90_ASYNC_STARTING;
+        rng90_async_kick(worker);
+        return;
+    }
+
+    // Keep going until the pool reaches its target, a failure waits for the next kick.
+    if (success)
+    {
+        rng90_async_kick(worker);
+    }
+}
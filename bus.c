@@ -0,0 +1,110 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "pico/time.h"
+
+#include "rng90/bus.h"
+#include "rng90_log.h"
+
+// Internal Function Definitions
+static void wait_hook(void* user_data, absolute_time_t until);
+static void run_head(rng90_bus_t* bus);
+
+void rng90_bus_init(rng90_bus_t* bus, rng90_context_t* ctx)
+{
+    bus->ctx = ctx;
+    bus->head = 0;
+    bus->count = 0;
+    bus->window_jobs = 0;
+    bus->overrun_max_us = 0;
+
+    rng90_set_wait_hook(ctx, wait_hook, bus);
+}
+
+void rng90_bus_deinit(rng90_bus_t* bus)
+{
+    rng90_set_wait_hook(bus->ctx, NULL, NULL);
+}
+
+bool rng90_bus_submit(rng90_bus_t* bus, rng90_bus_job_fn_t fn, void* user_data, uint32_t estimated_us)
+{
+    if (bus->count >= RNG90_BUS_QUEUE_SIZE)
+    {
+        return false;
+    }
+
+    struct rng90_bus_job* job = &bus->jobs[(bus->head + bus->count) % RNG90_BUS_QUEUE_SIZE];
+    job->fn = fn;
+    job->user_data = user_data;
+    job->estimated_us = estimated_us;
+    bus->count++;
+
+    return true;
+}
+
+size_t rng90_bus_run(rng90_bus_t* bus)
+{
+    size_t run = 0;
+    while (bus->count > 0)
+    {
+        run_head(bus);
+        run++;
+    }
+
+    return run;
+}
+
+size_t rng90_bus_pending(rng90_bus_t* bus)
+{
+    return bus->count;
+}
+
+// Internal function implementations
+
+static void wait_hook(void* user_data, absolute_time_t until)
+{
+    rng90_bus_t* bus = (rng90_bus_t*)user_data;
+
+    // Strictly in order, a later short job never overtakes one that doesn't fit.
+    while (bus->count > 0)
+    {
+        int64_t gap_us = absolute_time_diff_us(get_absolute_time(), until);
+        if (gap_us < (int64_t)bus->jobs[bus->head].estimated_us + RNG90_BUS_MARGIN_US)
+        {
+            return;
+        }
+
+        run_head(bus);
+        bus->window_jobs++;
+    }
+}
+
+static void run_head(rng90_bus_t* bus)
+{
+    struct rng90_bus_job job = bus->jobs[bus->head];
+    bus->head = (bus->head + 1) % RNG90_BUS_QUEUE_SIZE;
+    bus->count--;
+
+    absolute_time_t started = get_absolute_time();
+    job.fn(bus->ctx->i2c_inst, job.user_data);
+
+    int64_t overrun_us = absolute_time_diff_us(started, get_absolute_time()) - job.estimated_us;
+    if (overrun_us > (int64_t)bus->overrun_max_us)
+    {
+        bus->overrun_max_us = (uint32_t)overrun_us;
+        rng90_log(bus->ctx, "RNG90 bus job overran its estimate by %u us\n", (unsigned)overrun_us);
+    }
+}
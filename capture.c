@@ -0,0 +1,77 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "pico/time.h"
+
+#include "rng90/capture.h"
+#include "rng90/crc.h"
+
+bool rng90_capture_init(rng90_capture_t* cap, rng90_context_t* ctx)
+{
+    cap->ctx = ctx;
+    cap->sequence = 0;
+
+    return rng90_read_serial(ctx, cap->serial);
+}
+
+void rng90_capture_header(rng90_capture_t* cap, rng90_capture_header_t* header)
+{
+    memset(header, 0x00, sizeof(*header));
+    memcpy(header->magic, RNG90_CAPTURE_MAGIC, sizeof(header->magic));
+    header->version = RNG90_CAPTURE_VERSION;
+    header->record_size = sizeof(rng90_capture_record_t);
+    header->device_id = rng90_get_device_id(cap->ctx);
+    header->silicon_id = rng90_get_silicon_id(cap->ctx);
+    header->silicon_rev = rng90_get_silicon_rev(cap->ctx);
+    header->rfu = rng90_get_rfu(cap->ctx);
+    memcpy(header->serial, cap->serial, RNG90_SERIAL_SIZE);
+}
+
+size_t rng90_capture_records(rng90_capture_t* cap, rng90_capture_record_t* records, size_t count)
+{
+    size_t ok = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        rng90_capture_record_t* record = &records[i];
+
+        record->sequence = cap->sequence++;
+        memcpy(record->serial, cap->serial, RNG90_SERIAL_SIZE);
+
+        if (rng90_random(cap->ctx, record->data, RNG90_CAPTURE_DATA_SIZE))
+        {
+            record->status = RNG90_CAPTURE_STATUS_OK;
+            ++ok;
+        }
+        else
+        {
+            record->status = RNG90_CAPTURE_STATUS_FAILED;
+            memset(record->data, 0x00, RNG90_CAPTURE_DATA_SIZE);
+        }
+        record->timestamp_us = time_us_64();
+
+        rng90_crc16_context_t crc;
+        rng90_crc16_init(&crc);
+        rng90_crc16_update(&crc, (const uint8_t*)record, offsetof(rng90_capture_record_t, record_crc));
+        rng90_crc16_update(&crc, record->data, RNG90_CAPTURE_DATA_SIZE);
+        record->record_crc = rng90_crc16_final(&crc);
+    }
+
+    return ok;
+}
@@ -0,0 +1,79 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+
+#include "rng90/conditioner.h"
+#include "rng90/sha256.h"
+#include "rng90/wipe.h"
+
+#define DEVICE_BLOCK_SIZE 32
+
+bool rng90_random_conditioned(rng90_context_t* ctx, uint8_t* buf, size_t len, uint8_t ratio)
+{
+    if (ratio == 0)
+    {
+        return false;
+    }
+
+    uint8_t input[RNG90_SHA256_BLOCK_SIZE];
+    uint8_t digest[RNG90_SHA256_DIGEST_SIZE];
+    rng90_sha256_context_t sha;
+    bool result = true;
+
+    size_t offset = 0;
+    while (result && offset < len)
+    {
+        rng90_sha256_init(&sha);
+
+        uint8_t remaining = ratio;
+        while (result && remaining > 0)
+        {
+            uint8_t blocks = remaining >= 2 ? 2 : 1;
+            result = rng90_random(ctx, input, blocks * DEVICE_BLOCK_SIZE);
+            if (result)
+            {
+                rng90_sha256_update(&sha, input, blocks * DEVICE_BLOCK_SIZE);
+            }
+            remaining -= blocks;
+        }
+
+        if (!result)
+        {
+            break;
+        }
+
+        // Whole output blocks are written straight to the caller's buffer.
+        size_t to_copy = len - offset;
+        if (to_copy >= RNG90_SHA256_DIGEST_SIZE)
+        {
+            rng90_sha256_final(&sha, &buf[offset]);
+            to_copy = RNG90_SHA256_DIGEST_SIZE;
+        }
+        else
+        {
+            rng90_sha256_final(&sha, digest);
+            memcpy(&buf[offset], digest, to_copy);
+        }
+        offset += to_copy;
+    }
+
+    rng90_secure_wipe(input, sizeof(input));
+    rng90_secure_wipe(digest, sizeof(digest));
+    rng90_secure_wipe(&sha, sizeof(sha));
+
+    return result;
+}
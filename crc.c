@@ -14,56 +14,166 @@
  * If  not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <string.h>
+
 #include "rng90/crc.h"
+#include "rng90_hot.h"
+
+/*
+ * The RNG90 CRC reflects each input byte but not the final remainder.
+ *
+ * Processing the data LSB first with the reflected polynomial (0xA001) and
+ * reflecting the 16 bit remainder once at the end produces the same value
+ * as reflecting every input byte, this allows the division to be performed
+ * a byte at a time using the table below instead of a bit at a time.
+ */
+static const crc_t RNG90_HOT_DATA crc_table[256] = {
+    0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241,
+    0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
+    0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40,
+    0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
+    0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40,
+    0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
+    0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641,
+    0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
+    0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240,
+    0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
+    0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41,
+    0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
+    0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41,
+    0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
+    0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640,
+    0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
+    0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240,
+    0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
+    0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41,
+    0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
+    0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41,
+    0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
+    0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640,
+    0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
+    0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241,
+    0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
+    0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40,
+    0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
+    0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40,
+    0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
+    0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641,
+    0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040,
+};
 
-uint8_t reflect(uint8_t data)
+static crc_t RNG90_HOT_FUNC(reflect16)(crc_t data)
 {
-    uint8_t reflection = 0x00;
-    // Reflect the data about the center bit.
-    for (uint8_t bit = 0; bit < 8; ++bit)
-    {
-        if (data & 0x01)
-        {
-            reflection |= (1 << (7 - bit));
-        }
-        data = (data >> 1);
-    }
-    return reflection;
+    // Reflect the data about the center bit, swapping progressively smaller groups.
+    data = ((data >> 1) & 0x5555) | ((data & 0x5555) << 1);
+    data = ((data >> 2) & 0x3333) | ((data & 0x3333) << 2);
+    data = ((data >> 4) & 0x0F0F) | ((data & 0x0F0F) << 4);
+    data = (crc_t)((data >> 8) | (data << 8));
+    return data;
+}
+
+crc_t RNG90_HOT_FUNC(rng90_crc16)(const uint8_t* data, uint8_t length)
+{
+    rng90_crc16_context_t ctx;
+
+    rng90_crc16_init(&ctx);
+    rng90_crc16_update(&ctx, data, length);
+
+    return rng90_crc16_final(&ctx);
 }
 
-crc_t rng90_crc16(const uint8_t* data, uint8_t length)
+void RNG90_HOT_FUNC(rng90_crc16_init)(rng90_crc16_context_t* ctx)
 {
-    crc_t remainder = 0x00;
+    ctx->remainder = 0x00;
+}
+
+void RNG90_HOT_FUNC(rng90_crc16_update)(rng90_crc16_context_t* ctx, const uint8_t* data, size_t length)
+{
+    crc_t remainder = ctx->remainder;
 
-    for (uint8_t pos = 0; pos < length; ++pos)
+    for (size_t pos = 0; pos < length; ++pos)
     {
         /*
-         * Bring the next byte into the remainder.
+         * Bring the next byte into the remainder and divide all 8 bits at once.
          */
-        remainder ^= (reflect(data[pos]) << 8);
+        remainder = (remainder >> 8) ^ crc_table[(remainder ^ data[pos]) & 0xFF];
+    }
+
+    ctx->remainder = remainder;
+}
+
+crc_t RNG90_HOT_FUNC(rng90_crc16_final)(const rng90_crc16_context_t* ctx)
+{
+    /*
+     * The final remainder, reflected back, is the CRC result.
+     */
+    return reflect16(ctx->remainder);
+}
+
+bool RNG90_HOT_FUNC(rng90_crc16_check_frame)(const uint8_t* frame)
+{
+    uint8_t count = frame[0];
+    if (count < 3) return false; // Count byte plus CRC bytes at least.
 
+    uint8_t length = count - 2; // Exclude the CRC bytes.
+    crc_t crc = rng90_crc16(frame, length);
+
+    return (frame[length] == (uint8_t)(crc & 0xFF) && frame[length + 1] == (uint8_t)((crc >> 8) & 0xFF));
+}
+
+size_t rng90_crc16_check_frames(const uint8_t* const* frames, size_t count, uint8_t* bitmap)
+{
+    size_t valid = 0;
+
+    for (size_t pos = 0; pos < count; pos += 8)
+    {
         /*
-         * Perform modulo-2 division, a bit at a time.
+         * Build each bitmap byte in a register so it is written once.
          */
-        for (uint8_t bit = 8; bit > 0; --bit)
+        uint8_t bits = 0x00;
+        for (size_t bit = 0; bit < 8 && pos + bit < count; ++bit)
         {
-            /*
-             * Try to divide the current data bit.
-             */
-            if (remainder & 0x8000) // i.e. is most significant bit set
+            if (rng90_crc16_check_frame(frames[pos + bit]))
             {
-                remainder = (remainder << 1) ^ POLYNOMIAL;
-            }
-            else
-            {
-                remainder = (remainder << 1);
+                bits |= (uint8_t)(1 << bit);
+                ++valid;
             }
         }
+        bitmap[pos / 8] = bits;
     }
 
-    /*
-     * The final remainder is the CRC result.
-     */
-    remainder = remainder ^ 0x00; // Final XOR Step
-    return remainder;
-}
\ No newline at end of file
+    return valid;
+}
+
+bool RNG90_HOT_FUNC(rng90_crc16_check_frame_copy)(const uint8_t* frame, uint8_t* dest, size_t length)
+{
+    uint8_t count = frame[0];
+    if (count < 3 || (size_t)(count - 3) < length)
+    {
+        // No CRC or not enough packet data to fill the destination.
+        memset(dest, 0x00, length);
+        return false;
+    }
+
+    uint8_t payload_len = count - 2; // Exclude the CRC bytes.
+    crc_t remainder = crc_table[frame[0]];
+
+    for (uint8_t pos = 1; pos < payload_len; ++pos)
+    {
+        uint8_t data = frame[pos];
+        if (pos <= length)
+        {
+            dest[pos - 1] = data;
+        }
+        remainder = (remainder >> 8) ^ crc_table[(remainder ^ data) & 0xFF];
+    }
+
+    crc_t crc = reflect16(remainder);
+    if (frame[payload_len] != (uint8_t)(crc & 0xFF) || frame[payload_len + 1] != (uint8_t)((crc >> 8) & 0xFF))
+    {
+        memset(dest, 0x00, length);
+        return false;
+    }
+
+    return true;
+}
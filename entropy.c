@@ -0,0 +1,134 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+
+#include "pico/rand.h"
+
+#include "rng90/entropy.h"
+
+// Source used by the zero argument rng90_get_rand_32() and rng90_get_rand_64().
+static rng90_entropy_t* default_source = NULL;
+
+// Internal Function Definitions
+static void lock_pool(rng90_entropy_t* src);
+static void unlock_pool(rng90_entropy_t* src);
+
+void rng90_entropy_init(rng90_entropy_t* src, rng90_pool_t* pool, rng90_async_t* worker)
+{
+    src->pool = pool;
+    src->worker = worker;
+}
+
+bool rng90_entropy_is_healthy(rng90_entropy_t* src)
+{
+    lock_pool(src);
+    bool healthy = rng90_pool_is_healthy(src->pool);
+    unlock_pool(src);
+
+    return healthy;
+}
+
+size_t rng90_entropy_read(rng90_entropy_t* src, uint8_t* buf, size_t len, rng90_entropy_mode_t mode)
+{
+    const uint8_t* block;
+    size_t offset = 0;
+
+    lock_pool(src);
+
+    // Once the pool fails its health tests it holds no blocks, strong reads return nothing.
+    while (offset < len && rng90_pool_is_healthy(src->pool) && rng90_pool_try_acquire(src->pool, RNG90_POOL_PRIORITY_NORMAL, &block))
+    {
+        size_t remaining = len - offset;
+        size_t count = remaining < RNG90_POOL_BLOCK_SIZE ? remaining : RNG90_POOL_BLOCK_SIZE;
+        memcpy(&buf[offset], block, count);
+        rng90_pool_release(src->pool, block);
+        offset += count;
+    }
+
+    if (src->worker)
+    {
+        rng90_async_kick(src->worker);
+    }
+    unlock_pool(src);
+
+    if (mode == RNG90_ENTROPY_WEAK)
+    {
+        while (offset < len)
+        {
+            uint64_t value = get_rand_64();
+            size_t remaining = len - offset;
+            size_t count = remaining < sizeof(value) ? remaining : sizeof(value);
+            memcpy(&buf[offset], &value, count);
+            offset += count;
+        }
+    }
+
+    return offset;
+}
+
+uint32_t rng90_entropy_rand_32(rng90_entropy_t* src)
+{
+    uint32_t value;
+    rng90_entropy_read(src, (uint8_t*)&value, sizeof(value), RNG90_ENTROPY_WEAK);
+
+    return value;
+}
+
+uint64_t rng90_entropy_rand_64(rng90_entropy_t* src)
+{
+    uint64_t value;
+    rng90_entropy_read(src, (uint8_t*)&value, sizeof(value), RNG90_ENTROPY_WEAK);
+
+    return value;
+}
+
+void rng90_entropy_set_default(rng90_entropy_t* src)
+{
+    default_source = src;
+}
+
+uint32_t rng90_get_rand_32(void)
+{
+    return default_source ? rng90_entropy_rand_32(default_source) : get_rand_32();
+}
+
+uint64_t rng90_get_rand_64(void)
+{
+    return default_source ? rng90_entropy_rand_64(default_source) : get_rand_64();
+}
+
+// Internal function implementations
+
+/*
+ * The worker updates the pool from its async_context, which may be an IRQ or
+ * another task, so its lock is held whenever the pool is used.
+ */
+static void lock_pool(rng90_entropy_t* src)
+{
+    if (src->worker)
+    {
+        async_context_acquire_lock_blocking(src->worker->context);
+    }
+}
+
+static void unlock_pool(rng90_entropy_t* src)
+{
+    if (src->worker)
+    {
+        async_context_release_lock(src->worker->context);
+    }
+}
@@ -0,0 +1,187 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Measures the per block cost and jitter of the driver hot path with the XIP
+ * cache thrashed before every sample, build once with RNG90_HOT_IN_RAM off and
+ * once with it on to compare.
+ *
+ * The RNG90 is expected on i2c0 using the default SDA and SCL pins.
+ */
+
+#include <stdio.h>
+
+#include "hardware/gpio.h"
+#include "hardware/i2c.h"
+#include "pico/stdlib.h"
+
+#include "rng90/crc.h"
+#include "rng90/rng90.h"
+
+#define I2C_BAUDRATE 100000
+
+#define CRC_SAMPLES 1000
+#define RANDOM_SAMPLES 100
+
+// Larger than the 16 KB XIP cache so reading it evicts the driver's code and tables.
+#define THRASH_SIZE (64 * 1024)
+
+static const uint8_t thrash_data[THRASH_SIZE] = { 1 };
+
+struct stats {
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t total_us;
+    uint32_t samples;
+};
+
+static void thrash_cache(void)
+{
+    volatile uint32_t sum = 0;
+    for (size_t i = 0; i < THRASH_SIZE; i += 8)
+    {
+        sum += thrash_data[i];
+    }
+}
+
+static void stats_init(struct stats* s)
+{
+    s->min_us = UINT32_MAX;
+    s->max_us = 0;
+    s->total_us = 0;
+    s->samples = 0;
+}
+
+static void stats_add(struct stats* s, uint32_t elapsed_us)
+{
+    s->min_us = elapsed_us < s->min_us ? elapsed_us : s->min_us;
+    s->max_us = elapsed_us > s->max_us ? elapsed_us : s->max_us;
+    s->total_us += elapsed_us;
+    s->samples++;
+}
+
+static void stats_print(const char* label, const struct stats* s)
+{
+    if (s->samples == 0)
+    {
+        printf("%s: no samples\n", label);
+        return;
+    }
+
+    printf("%s: min %lu us, max %lu us, mean %lu us, jitter %lu us\n", label,
+        (unsigned long)s->min_us, (unsigned long)s->max_us,
+        (unsigned long)(s->total_us / s->samples), (unsigned long)(s->max_us - s->min_us));
+}
+
+static void bench_crc(void)
+{
+    // A Random response frame, count 35 with 32 data bytes and its CRC.
+    uint8_t frame[35] = { 35 };
+    for (size_t i = 1; i < 33; i++)
+    {
+        frame[i] = (uint8_t)(i * 37);
+    }
+    crc_t crc = rng90_crc16(frame, 33);
+    frame[33] = (uint8_t)(crc & 0xFF);
+    frame[34] = (uint8_t)(crc >> 8);
+
+    uint8_t dest[32];
+    struct stats s;
+    stats_init(&s);
+
+    for (int i = 0; i < CRC_SAMPLES; i++)
+    {
+        thrash_cache();
+        uint32_t start = time_us_32();
+        bool valid = rng90_crc16_check_frame_copy(frame, dest, sizeof(dest));
+        uint32_t elapsed = time_us_32() - start;
+        if (valid)
+        {
+            stats_add(&s, elapsed);
+        }
+    }
+
+    stats_print("CRC check and copy, cold cache", &s);
+}
+
+/*
+ * Times only the host side of a block, reading the response, checking its CRC
+ * and copying it out. Random is started and left to complete before the clock
+ * starts so the 20-25 ms the device spends computing is kept out of the samples,
+ * the I2C transfer of the response is still included.
+ */
+static void bench_random(rng90_context_t* ctx)
+{
+    uint8_t buf[32];
+    struct stats s;
+    stats_init(&s);
+
+    // The first block includes the self-tests, keep it out of the samples.
+    rng90_random(ctx, buf, sizeof(buf));
+
+    for (int i = 0; i < RANDOM_SAMPLES; i++)
+    {
+        if (!rng90_random_start(ctx))
+        {
+            continue;
+        }
+        sleep_until(rng90_random_ready_at(ctx));
+
+        thrash_cache();
+        uint32_t start = time_us_32();
+        bool result = rng90_random_finish(ctx, buf, sizeof(buf));
+        uint32_t elapsed = time_us_32() - start;
+        if (result)
+        {
+            stats_add(&s, elapsed);
+        }
+    }
+
+    stats_print("Random response read, check and copy, cold cache", &s);
+}
+
+int main(void)
+{
+    stdio_init_all();
+    sleep_ms(2000);
+
+    i2c_init(i2c0, I2C_BAUDRATE);
+    gpio_set_function(PICO_DEFAULT_I2C_SDA_PIN, GPIO_FUNC_I2C);
+    gpio_set_function(PICO_DEFAULT_I2C_SCL_PIN, GPIO_FUNC_I2C);
+    gpio_pull_up(PICO_DEFAULT_I2C_SDA_PIN);
+    gpio_pull_up(PICO_DEFAULT_I2C_SCL_PIN);
+
+    rng90_context_t ctx;
+    rng90_set_i2c_instance(&ctx, i2c0);
+    rng90_init(&ctx);
+
+    printf("RNG90 hot path benchmark\n");
+    bench_crc();
+
+    if (rng90_is_initialized(&ctx))
+    {
+        bench_random(&ctx);
+    }
+    else
+    {
+        printf("RNG90 not found, skipping device timings\n");
+    }
+
+    while (true)
+    {
+        tight_loop_contents();
+    }
+}
@@ -0,0 +1,91 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Streams a capture over USB CDC, the header followed by records until the
+ * host disconnects, for writing to a file with the rng90_capture host tool.
+ *
+ * The RNG90 is expected on i2c0 using the default SDA and SCL pins.
+ */
+
+#include <stdio.h>
+
+#include "hardware/gpio.h"
+#include "hardware/i2c.h"
+#include "pico/stdlib.h"
+#include "pico/stdio_usb.h"
+
+#include "rng90/capture.h"
+#include "rng90/rng90.h"
+
+#define I2C_BAUDRATE 100000
+
+#define RECORDS_PER_BATCH 16
+
+static rng90_capture_record_t records[RECORDS_PER_BATCH];
+
+static void write_raw(const void* data, size_t size)
+{
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < size; i++)
+    {
+        putchar_raw(bytes[i]);
+    }
+}
+
+int main(void)
+{
+    stdio_init_all();
+
+    i2c_init(i2c0, I2C_BAUDRATE);
+    gpio_set_function(PICO_DEFAULT_I2C_SDA_PIN, GPIO_FUNC_I2C);
+    gpio_set_function(PICO_DEFAULT_I2C_SCL_PIN, GPIO_FUNC_I2C);
+    gpio_pull_up(PICO_DEFAULT_I2C_SDA_PIN);
+    gpio_pull_up(PICO_DEFAULT_I2C_SCL_PIN);
+
+    rng90_context_t ctx;
+    rng90_set_i2c_instance(&ctx, i2c0);
+    rng90_init(&ctx);
+    rng90_set_speculative(&ctx, true);
+
+    rng90_capture_t cap;
+    bool ready = rng90_is_initialized(&ctx) && rng90_capture_init(&cap, &ctx);
+
+    while (true)
+    {
+        // Each connection starts a new capture with its own header.
+        while (!stdio_usb_connected())
+        {
+            sleep_ms(100);
+        }
+
+        if (!ready)
+        {
+            sleep_ms(1000);
+            continue;
+        }
+
+        rng90_capture_header_t header;
+        rng90_capture_header(&cap, &header);
+        write_raw(&header, sizeof(header));
+
+        while (stdio_usb_connected())
+        {
+            rng90_capture_records(&cap, records, RECORDS_PER_BATCH);
+            write_raw(records, sizeof(records));
+        }
+    }
+}
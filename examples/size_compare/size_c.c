@@ -0,0 +1,69 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * The C half of the rng90.hpp size comparison, the same program as
+ * size_cpp.cpp written against the C driver. Compare the two with
+ * arm-none-eabi-size, the wrapper should add nothing.
+ *
+ * The RNG90 is expected on i2c0 using the default SDA and SCL pins.
+ */
+
+#include <stdio.h>
+
+#include "hardware/gpio.h"
+#include "hardware/i2c.h"
+#include "pico/stdlib.h"
+
+#include "rng90/rng90.h"
+
+#define I2C_BAUDRATE 100000
+
+// Internal Function Definitions
+static void poll_wait(void* user_data, absolute_time_t until);
+
+static rng90_context_t rng90;
+
+int main()
+{
+    stdio_init_all();
+
+    i2c_init(i2c0, I2C_BAUDRATE);
+    gpio_set_function(PICO_DEFAULT_I2C_SDA_PIN, GPIO_FUNC_I2C);
+    gpio_set_function(PICO_DEFAULT_I2C_SCL_PIN, GPIO_FUNC_I2C);
+
+    rng90_set_i2c_instance(&rng90, i2c0);
+    rng90_set_wait_hook(&rng90, poll_wait, NULL);
+    rng90_init(&rng90);
+
+    uint8_t block[32];
+    while (true)
+    {
+        if (rng90_random(&rng90, block, sizeof(block)))
+        {
+            printf("%02X%02X%02X%02X\n", block[0], block[1], block[2], block[3]);
+        }
+        sleep_ms(1000);
+    }
+}
+
+// Internal function implementations
+
+static void poll_wait(void* user_data, absolute_time_t until)
+{
+    (void)user_data;
+    busy_wait_until(until);
+}
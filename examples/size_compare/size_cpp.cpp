@@ -0,0 +1,56 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * The C++ half of the rng90.hpp size comparison, the same program as
+ * size_c.c written against rng90::device. Compare the two with
+ * arm-none-eabi-size, the wrapper should add nothing.
+ *
+ * The RNG90 is expected on i2c0 using the default SDA and SCL pins.
+ */
+
+#include <cstdio>
+
+#include "hardware/gpio.h"
+#include "hardware/i2c.h"
+#include "pico/stdlib.h"
+
+#include "rng90/rng90.hpp"
+
+#define I2C_BAUDRATE 100000
+
+static rng90::device<rng90::hw_i2c<0>, rng90::poll_timing, rng90::no_log> rng90_device;
+
+int main()
+{
+    stdio_init_all();
+
+    i2c_init(i2c0, I2C_BAUDRATE);
+    gpio_set_function(PICO_DEFAULT_I2C_SDA_PIN, GPIO_FUNC_I2C);
+    gpio_set_function(PICO_DEFAULT_I2C_SCL_PIN, GPIO_FUNC_I2C);
+
+    rng90_device.init();
+
+    std::array<std::uint8_t, 32> block;
+    while (true)
+    {
+        if (rng90_device.fill(block))
+        {
+            std::printf("%02X%02X%02X%02X\n", block[0], block[1], block[2], block[3]);
+        }
+        sleep_ms(1000);
+    }
+}
@@ -0,0 +1,115 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RNG90_ASYNC_H
+#define RNG90_ASYNC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "pico/async_context.h"
+
+#include "rng90/pool.h"
+#include "rng90/rng90.h"
+
+typedef enum {
+    RNG90_ASYNC_IDLE,
+    RNG90_ASYNC_STARTING,
+    RNG90_ASYNC_WAKING,
+    RNG90_ASYNC_RANDOM
+} rng90_async_state_t;
+
+typedef struct rng90_async rng90_async_t;
+
+/**
+ * Called from the async_context when a request completes.
+ */
+typedef void (*rng90_async_callback_t)(rng90_async_t* worker, bool success, void* user_data);
+
+struct rng90_async {
+    rng90_context_t* ctx;
+    async_context_t* context;
+    async_when_pending_worker_t start_worker;
+    async_at_time_worker_t timer_worker;
+    rng90_async_state_t state;
+    uint8_t* buf;
+    size_t len;
+    size_t offset;
+    rng90_async_callback_t callback;
+    void* user_data;
+    rng90_pool_t* pool;
+    uint8_t* refill_block;
+    rng90_pool_t* refill_pool;
+    // A request made during a background refill, started once the refill completes.
+    bool queued;
+    uint8_t* queued_buf;
+    size_t queued_len;
+    rng90_async_callback_t queued_callback;
+    void* queued_user_data;
+};
+
+/**
+ * Initialise a worker running RNG90 requests on an async_context, the device
+ * identified by ctx must already be initialised.
+ *
+ * Returns false if the worker could not be added to the context.
+ */
+bool rng90_async_init(rng90_async_t* worker, async_context_t* context, rng90_context_t* ctx);
+
+/**
+ * Remove the worker from its async_context, any request in progress or queued
+ * is abandoned without calling its callback and a refill slot is returned to
+ * the pool.
+ */
+void rng90_async_deinit(rng90_async_t* worker);
+
+/**
+ * Start filling buf with len random bytes, callback is called from the
+ * async_context once buf is filled or an error occurs.
+ *
+ * The device is woken if necessary and each block is requested, waited for and
+ * read by at-time workers so the async_context is never blocked waiting on the
+ * device. Must be called from the async_context or with its lock held.
+ *
+ * Returns false if a request is already in progress or queued.
+ */
+bool rng90_async_random(rng90_async_t* worker, uint8_t* buf, size_t len,
+    rng90_async_callback_t callback, void* user_data);
+
+/**
+ * Refill pool in the background whenever the worker is idle and the pool is
+ * below its target, pass NULL to stop. The pool must use the same device. A
+ * refill already in progress completes into the pool it was started for.
+ *
+ * Refills only start when the worker is kicked with rng90_async_kick(), a
+ * request made with rng90_async_random() while a refill block is in progress
+ * is queued and started as soon as that block completes.
+ */
+void rng90_async_set_pool(rng90_async_t* worker, rng90_pool_t* pool);
+
+/**
+ * Schedule the worker to check whether its pool needs a refill, safe to call
+ * from any context including after taking blocks from the pool.
+ */
+void rng90_async_kick(rng90_async_t* worker);
+
+/**
+ * Is a request in progress on the worker.
+ */
+bool rng90_async_is_busy(rng90_async_t* worker);
+
+#endif // RNG90_ASYNC_H
@@ -0,0 +1,99 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RNG90_BUS_H
+#define RNG90_BUS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hardware/i2c.h"
+
+#include "rng90/rng90.h"
+
+// Maximum number of transactions for other devices waiting on the bus.
+#ifndef RNG90_BUS_QUEUE_SIZE
+#define RNG90_BUS_QUEUE_SIZE 8
+#endif
+
+// Time kept clear before the RNG90 is next due so its completion read isn't delayed.
+#ifndef RNG90_BUS_MARGIN_US
+#define RNG90_BUS_MARGIN_US 100
+#endif
+
+/**
+ * A transaction for another device sharing the bus, called with the bus
+ * instance the RNG90 is using.
+ */
+typedef void (*rng90_bus_job_fn_t)(i2c_inst_t* i2c, void* user_data);
+
+struct rng90_bus_job {
+    rng90_bus_job_fn_t fn;
+    void* user_data;
+    uint32_t estimated_us;
+};
+
+struct rng90_bus {
+    rng90_context_t* ctx;
+    struct rng90_bus_job jobs[RNG90_BUS_QUEUE_SIZE];
+    uint8_t head;
+    uint8_t count;
+    // Jobs run while the RNG90 was busy and the longest overrun of an estimate.
+    uint32_t window_jobs;
+    uint32_t overrun_max_us;
+};
+
+typedef struct rng90_bus rng90_bus_t;
+
+/**
+ * Initialise an arbiter for the bus shared with the RNG90 device identified by
+ * ctx, installing a wait hook so queued transactions run while the device is
+ * computing a Random result or powering up.
+ *
+ * The arbiter is intended for use from the core that drives the RNG90.
+ */
+void rng90_bus_init(rng90_bus_t* bus, rng90_context_t* ctx);
+
+/**
+ * Remove the wait hook, any queued transactions are left in the queue.
+ */
+void rng90_bus_deinit(rng90_bus_t* bus);
+
+/**
+ * Queue a transaction for another device on the bus, estimated_us being the
+ * time it holds the bus for. Transactions run in the order submitted, each
+ * once there is a gap of at least estimated_us plus RNG90_BUS_MARGIN_US
+ * before the RNG90 is next due. The transaction must not use the RNG90.
+ *
+ * Returns false if the queue is full.
+ */
+bool rng90_bus_submit(rng90_bus_t* bus, rng90_bus_job_fn_t fn, void* user_data, uint32_t estimated_us);
+
+/**
+ * Run all queued transactions now, for use when no RNG90 request is in
+ * progress on this core.
+ *
+ * Returns the number of transactions run.
+ */
+size_t rng90_bus_run(rng90_bus_t* bus);
+
+/**
+ * Get the number of queued transactions.
+ */
+size_t rng90_bus_pending(rng90_bus_t* bus);
+
+#endif // RNG90_BUS_H
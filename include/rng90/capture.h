@@ -0,0 +1,67 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RNG90_CAPTURE_H
+#define RNG90_CAPTURE_H
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rng90/capture_format.h"
+#include "rng90/rng90.h"
+
+static_assert(RNG90_CAPTURE_SERIAL_SIZE == RNG90_SERIAL_SIZE, "capture serial size");
+
+/*
+ * The device side produces records, moving them off the board is up to the
+ * application. examples/capture_stream streams a capture over USB CDC and
+ * tools/capture/rng90_capture writes that stream into a memory-mapped file
+ * on the host, checking each record's CRC as it arrives.
+ */
+
+struct rng90_capture {
+    rng90_context_t* ctx;
+    uint8_t serial[RNG90_SERIAL_SIZE];
+    uint32_t sequence;
+};
+
+typedef struct rng90_capture rng90_capture_t;
+
+/**
+ * Initialise a capture from an initialised RNG90 device, reading its serial number.
+ *
+ * Returns false if the serial number could not be read.
+ */
+bool rng90_capture_init(rng90_capture_t* cap, rng90_context_t* ctx);
+
+/**
+ * Populate the header to be written at the start of the capture.
+ */
+void rng90_capture_header(rng90_capture_t* cap, rng90_capture_header_t* header);
+
+/**
+ * Capture count blocks from the device into consecutive records.
+ *
+ * A block that fails to be read is still recorded, with a failed status and
+ * zeroed data, so sequence numbers remain contiguous.
+ *
+ * Returns the number of records with an OK status.
+ */
+size_t rng90_capture_records(rng90_capture_t* cap, rng90_capture_record_t* records, size_t count);
+
+#endif // RNG90_CAPTURE_H
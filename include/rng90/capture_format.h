@@ -0,0 +1,72 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RNG90_CAPTURE_FORMAT_H
+#define RNG90_CAPTURE_FORMAT_H
+
+#include <assert.h>
+#include <stdint.h>
+
+/*
+ * A capture is a single header followed by fixed size records, all fields
+ * little-endian. As every record is the same size, record n of a capture
+ * can be located at sizeof(header) + n * record_size without parsing the
+ * records before it, so a host can memory map a capture and slice it directly.
+ *
+ * This header has no Pico SDK dependencies so host tools can share it.
+ */
+
+#define RNG90_CAPTURE_MAGIC "RNG90CAP"
+#define RNG90_CAPTURE_VERSION 1
+#define RNG90_CAPTURE_DATA_SIZE 32
+#define RNG90_CAPTURE_SERIAL_SIZE 9
+
+typedef enum {
+    RNG90_CAPTURE_STATUS_OK      = 0x00,
+    RNG90_CAPTURE_STATUS_FAILED  = 0x01,
+    // Set by the host when the record CRC doesn't match after transfer.
+    RNG90_CAPTURE_STATUS_CORRUPT = 0x02
+} rng90_capture_status_t;
+
+struct rng90_capture_header {
+    char magic[8];
+    uint16_t version;
+    uint16_t record_size;
+    uint8_t device_id;
+    uint8_t silicon_id;
+    uint8_t silicon_rev;
+    uint8_t rfu;
+    uint8_t serial[RNG90_CAPTURE_SERIAL_SIZE];
+    uint8_t reserved[7];
+};
+
+struct rng90_capture_record {
+    uint64_t timestamp_us;
+    uint32_t sequence;
+    uint8_t serial[RNG90_CAPTURE_SERIAL_SIZE];
+    uint8_t status;
+    // CRC-16 of the fields before this one followed by the data.
+    uint16_t record_crc;
+    uint8_t data[RNG90_CAPTURE_DATA_SIZE];
+};
+
+typedef struct rng90_capture_header rng90_capture_header_t;
+typedef struct rng90_capture_record rng90_capture_record_t;
+
+static_assert(sizeof(rng90_capture_header_t) == 32, "capture header layout");
+static_assert(sizeof(rng90_capture_record_t) == 56, "capture record layout");
+
+#endif // RNG90_CAPTURE_FORMAT_H
@@ -0,0 +1,42 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RNG90_CONDITIONER_H
+#define RNG90_CONDITIONER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rng90/rng90.h"
+
+// By default 512 bits of device output are compressed into each 256 bit output block.
+#define RNG90_CONDITIONER_RATIO_DEFAULT 2
+
+/**
+ * Generate random bytes from the RNG90 device conditioned through SHA-256.
+ *
+ * Each 32 byte block written to buf is the SHA-256 digest of ratio 32 byte
+ * blocks read from the device, so the ratio is the input:output compression
+ * applied. Device blocks are requested in pairs so that each pair fills exactly
+ * one SHA-256 compression.
+ *
+ * Returns true on success, false if ratio is 0 or on any error reading from
+ * the device.
+ */
+bool rng90_random_conditioned(rng90_context_t* ctx, uint8_t* buf, size_t len, uint8_t ratio);
+
+#endif // RNG90_CONDITIONER_H
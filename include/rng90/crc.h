@@ -17,12 +17,66 @@
 #ifndef RNG90_CRC_H
 #define RNG90_CRC_H
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #define POLYNOMIAL 0x8005
 
 typedef uint16_t crc_t;
 
+struct rng90_crc16_context {
+    crc_t remainder;
+};
+
+typedef struct rng90_crc16_context rng90_crc16_context_t;
+
 crc_t rng90_crc16(const uint8_t* data, uint8_t length);
 
+/**
+ * Start an incremental CRC calculation.
+ */
+void rng90_crc16_init(rng90_crc16_context_t* ctx);
+
+/**
+ * Bring the next length bytes into an incremental CRC calculation.
+ *
+ * The data can be supplied in as many chunks as it arrives, the result
+ * is the same as passing the concatenated data to rng90_crc16().
+ */
+void rng90_crc16_update(rng90_crc16_context_t* ctx, const uint8_t* data, size_t length);
+
+/**
+ * Get the CRC of all data passed to rng90_crc16_update() since rng90_crc16_init().
+ *
+ * The context is not modified so further data may still be added.
+ */
+crc_t rng90_crc16_final(const rng90_crc16_context_t* ctx);
+
+/**
+ * Validate the CRC of a single frame in the form [Count] [Packet] [CRC-LSB] [CRC-MSB].
+ *
+ * Frames with a count too small to hold a CRC are reported as invalid.
+ */
+bool rng90_crc16_check_frame(const uint8_t* frame);
+
+/**
+ * Validate the CRC of a batch of frames.
+ *
+ * Bit (n % 8) of bitmap[n / 8] is set if frames[n] is valid and cleared otherwise,
+ * bitmap must therefore be at least (count + 7) / 8 bytes long.
+ *
+ * Returns the number of valid frames.
+ */
+size_t rng90_crc16_check_frames(const uint8_t* const* frames, size_t count, uint8_t* bitmap);
+
+/**
+ * Validate the CRC of a frame while copying the first length bytes of its packet
+ * into dest, the frame is only read once.
+ *
+ * If the CRC does not match, or the packet is shorter than length, dest is zeroed
+ * and false is returned.
+ */
+bool rng90_crc16_check_frame_copy(const uint8_t* frame, uint8_t* dest, size_t length);
+
 #endif // RNG90_CRC_H
\ No newline at end of file
@@ -0,0 +1,93 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RNG90_ENTROPY_H
+#define RNG90_ENTROPY_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "rng90/async.h"
+#include "rng90/pool.h"
+
+typedef enum {
+    // Only health tested bytes from the RNG90 device are returned, which may be fewer than requested.
+    RNG90_ENTROPY_STRONG,
+    // Any shortfall from the device is made up from pico_rand.
+    RNG90_ENTROPY_WEAK
+} rng90_entropy_mode_t;
+
+struct rng90_entropy {
+    rng90_pool_t* pool;
+    rng90_async_t* worker;
+};
+
+typedef struct rng90_entropy rng90_entropy_t;
+
+/**
+ * Initialise an entropy source drawing from pool.
+ *
+ * If worker is not NULL it should have been given the same pool with
+ * rng90_async_set_pool(), it is kicked after each read so the pool is refilled
+ * in the background. Otherwise the application is responsible for refilling
+ * the pool, for example by calling rng90_pool_service() from its main loop.
+ *
+ * When worker is set, reads hold the worker's async_context lock while they
+ * use the pool, so they may be made from any task or core but not from an IRQ
+ * handler. Any other access to the pool must also hold that lock.
+ */
+void rng90_entropy_init(rng90_entropy_t* src, rng90_pool_t* pool, rng90_async_t* worker);
+
+/**
+ * Read up to len bytes from the entropy source without ever waiting on the
+ * device, only blocks already held in the pool are used.
+ *
+ * Each block taken from the pool is wiped once copied, a read of less than a
+ * whole block still consumes the block.
+ *
+ * Returns the number of bytes written to buf, always len in weak mode.
+ */
+size_t rng90_entropy_read(rng90_entropy_t* src, uint8_t* buf, size_t len, rng90_entropy_mode_t mode);
+
+/**
+ * Is the source's pool clear of a latched health test failure, taking the
+ * same lock as rng90_entropy_read().
+ */
+bool rng90_entropy_is_healthy(rng90_entropy_t* src);
+
+/**
+ * Equivalents of get_rand_32() and get_rand_64() from pico_rand drawing from
+ * src, returning device output when the pool has a block ready and falling
+ * back to pico_rand otherwise.
+ */
+uint32_t rng90_entropy_rand_32(rng90_entropy_t* src);
+uint64_t rng90_entropy_rand_64(rng90_entropy_t* src);
+
+/**
+ * Set the source used by rng90_get_rand_32() and rng90_get_rand_64(), pass
+ * NULL to use pico_rand alone.
+ */
+void rng90_entropy_set_default(rng90_entropy_t* src);
+
+/**
+ * Drop in replacements for get_rand_32() and get_rand_64(), with the same
+ * signatures, drawing from the source set with rng90_entropy_set_default().
+ */
+uint32_t rng90_get_rand_32(void);
+uint64_t rng90_get_rand_64(void);
+
+#endif // RNG90_ENTROPY_H
@@ -0,0 +1,41 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RNG90_FRAMES_H
+#define RNG90_FRAMES_H
+
+/*
+ * Fixed commands as written to the bus, word address through CRC, with the
+ * CRC precomputed. rng90_check_frames.cmake checks each CRC when the
+ * project is configured and rng90.hpp checks each against a frame built
+ * with the constexpr CRC, so a mistake here breaks the build.
+ */
+
+#define RNG90_FRAME_INFO_SIZE 8
+#define RNG90_FRAME_INFO { 0x03, 0x07, 0x30, 0x00, 0x00, 0x00, 0x03, 0x5D }
+
+// Random with param1 0x00 and the 20 data bytes zeroed.
+#define RNG90_FRAME_RANDOM_SIZE 28
+#define RNG90_FRAME_RANDOM { 0x03, 0x1B, 0x16, 0x00, 0x00, 0x00, \
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+    0x7D, 0xE0 }
+
+// Read with param1 0x01, the serial number.
+#define RNG90_FRAME_READ_SERIAL_SIZE 8
+#define RNG90_FRAME_READ_SERIAL { 0x03, 0x07, 0x02, 0x01, 0x00, 0x00, 0x1D, 0xA7 }
+
+#endif // RNG90_FRAMES_H
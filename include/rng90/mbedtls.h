@@ -0,0 +1,38 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RNG90_MBEDTLS_H
+#define RNG90_MBEDTLS_H
+
+#include <stddef.h>
+
+#include "rng90/entropy.h"
+
+/**
+ * mbedTLS entropy source callbacks, data must point to an initialised
+ * rng90_entropy_t. Register with mbedtls_entropy_add_source() using
+ * MBEDTLS_ENTROPY_SOURCE_STRONG or MBEDTLS_ENTROPY_SOURCE_WEAK to match.
+ *
+ * Neither callback waits on the device, the strong callback only returns bytes
+ * already buffered in the pool and may report fewer than requested, leaving
+ * mbedTLS to poll again once the pool has been refilled. Blocks only reach the
+ * pool after passing its health tests, see rng90_pool_set_monitor(), and the
+ * strong callback returns MBEDTLS_ERR_ENTROPY_SOURCE_FAILED once they fail.
+ */
+int rng90_mbedtls_poll_strong(void* data, unsigned char* output, size_t len, size_t* olen);
+int rng90_mbedtls_poll_weak(void* data, unsigned char* output, size_t len, size_t* olen);
+
+#endif // RNG90_MBEDTLS_H
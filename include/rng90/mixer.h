@@ -0,0 +1,87 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RNG90_MIXER_H
+#define RNG90_MIXER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "pico/time.h"
+
+#include "rng90/rng90.h"
+#include "rng90/sha256.h"
+
+// Time to wait after a device failure before trying the device again.
+#ifndef RNG90_MIXER_RETRY_MS
+#define RNG90_MIXER_RETRY_MS 1000
+#endif
+
+// pico_rand bits gathered per output block alongside a device block, rounded up to 128.
+#ifndef RNG90_MIXER_SUPPLEMENT_BITS
+#define RNG90_MIXER_SUPPLEMENT_BITS 128
+#endif
+
+// pico_rand bits gathered per output block while the device is unavailable, see rng90_mixer_random().
+#ifndef RNG90_MIXER_FALLBACK_BITS
+#define RNG90_MIXER_FALLBACK_BITS 512
+#endif
+
+struct rng90_mixer {
+    rng90_context_t* ctx;
+    uint8_t state[RNG90_SHA256_DIGEST_SIZE];
+    uint32_t counter;
+    bool device_available;
+    absolute_time_t retry_at;
+};
+
+typedef struct rng90_mixer rng90_mixer_t;
+
+/**
+ * Initialise a mixer combining output from the RNG90 device identified by ctx
+ * with bits from pico_rand.
+ *
+ * The initial state is seeded from pico_rand.
+ */
+void rng90_mixer_init(rng90_mixer_t* mixer, rng90_context_t* ctx);
+
+/**
+ * Generate random bytes from the mixer.
+ *
+ * Each 32 byte output block is extracted through SHA-256 from the mixer state,
+ * a block from the RNG90 device when it is available and pico_rand bits. If
+ * the device fails it is put to sleep to clear its state and output continues
+ * from pico_rand alone at a reduced rate, the device is retried every
+ * RNG90_MIXER_RETRY_MS and folded back in once it recovers.
+ *
+ * Fallback output is reduced assurance. pico_rand is not a cryptographic
+ * generator and its seed holds far less entropy than the bits gathered, so
+ * fallback blocks are only unpredictable as long as the mixer state from
+ * earlier device blocks stays secret. Callers needing full strength must
+ * treat a false return as a failure.
+ *
+ * Returns true if every output block included a device block, false if any
+ * block was generated in fallback mode. buf is always filled.
+ */
+bool rng90_mixer_random(rng90_mixer_t* mixer, uint8_t* buf, size_t len);
+
+/**
+ * Is the RNG90 device currently contributing to the mixer output.
+ */
+bool rng90_mixer_is_device_available(rng90_mixer_t* mixer);
+
+#endif // RNG90_MIXER_H
@@ -0,0 +1,102 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RNG90_MONITOR_H
+#define RNG90_MONITOR_H
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define RNG90_MONITOR_BLOCK_SIZE 32
+
+// Blocks per evaluation window, at most 2047 to keep histogram counts within 16 bits.
+#ifndef RNG90_MONITOR_WINDOW_BLOCKS
+#define RNG90_MONITOR_WINDOW_BLOCKS 64
+#endif
+
+static_assert(RNG90_MONITOR_WINDOW_BLOCKS * RNG90_MONITOR_BLOCK_SIZE <= UINT16_MAX,
+    "RNG90_MONITOR_WINDOW_BLOCKS must keep histogram counts within 16 bits");
+
+// Chi-square critical value for 255 degrees of freedom at p = 0.0001.
+#define RNG90_MONITOR_CHI_SQUARE_LIMIT_DEFAULT 330.5f
+// Number of standard deviations allowed for bit balance, runs and serial correlation.
+#define RNG90_MONITOR_SIGMA_LIMIT_DEFAULT 4
+
+typedef enum {
+    RNG90_MONITOR_ALARM_NONE        = 0x00,
+    RNG90_MONITOR_ALARM_CHI_SQUARE  = 0x01,
+    RNG90_MONITOR_ALARM_BIT_BALANCE = 0x02,
+    RNG90_MONITOR_ALARM_RUNS        = 0x04,
+    RNG90_MONITOR_ALARM_SERIAL      = 0x08
+} rng90_monitor_alarm_t;
+
+struct rng90_monitor_window {
+    uint32_t bytes;
+    float chi_square;
+    uint32_t ones;
+    uint32_t runs;
+    float serial_correlation;
+    uint8_t alarms;
+};
+
+typedef struct rng90_monitor_window rng90_monitor_window_t;
+
+struct rng90_monitor {
+    // Thresholds, set to the defaults by rng90_monitor_init().
+    float chi_square_limit;
+    uint8_t sigma_limit;
+    // Running state for the current window.
+    uint16_t histogram[256];
+    uint16_t blocks;
+    uint32_t ones;
+    uint32_t transitions;
+    uint32_t sum;
+    uint64_t sum_squares;
+    uint64_t sum_products;
+    uint8_t last_byte;
+    // Results of the most recently completed window.
+    rng90_monitor_window_t window;
+    uint32_t windows;
+    uint32_t alarm_windows;
+};
+
+typedef struct rng90_monitor rng90_monitor_t;
+
+/**
+ * Initialise a quality monitor with the default thresholds.
+ */
+void rng90_monitor_init(rng90_monitor_t* mon);
+
+/**
+ * Add the next 32 byte block of output to the monitor.
+ *
+ * Statistics are accumulated incrementally at a fixed cost per block, each
+ * RNG90_MONITOR_WINDOW_BLOCKS blocks the window is evaluated, the counters
+ * are reset and the alarms raised for that window are returned.
+ *
+ * Returns a bitmask of rng90_monitor_alarm_t, RNG90_MONITOR_ALARM_NONE if
+ * the window is still open or passed.
+ */
+uint8_t rng90_monitor_update(rng90_monitor_t* mon, const uint8_t* block);
+
+/**
+ * Get the results of the most recently completed window.
+ */
+const rng90_monitor_window_t* rng90_monitor_get_window(rng90_monitor_t* mon);
+
+#endif // RNG90_MONITOR_H
@@ -0,0 +1,281 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RNG90_POOL_H
+#define RNG90_POOL_H
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "pico/time.h"
+
+#include "rng90/monitor.h"
+#include "rng90/rng90.h"
+
+#define RNG90_POOL_BLOCK_SIZE 32
+
+// Number of 32 byte slots in each pool, at most 32.
+#ifndef RNG90_POOL_SLOTS
+#define RNG90_POOL_SLOTS 8
+#endif
+
+// Acquisitions closer together than this are treated as one burst.
+#ifndef RNG90_POOL_BURST_GAP_MS
+#define RNG90_POOL_BURST_GAP_MS 10
+#endif
+
+// Consecutive monitor windows with an alarm before the pool is marked failed.
+#ifndef RNG90_POOL_ALARM_WINDOWS
+#define RNG90_POOL_ALARM_WINDOWS 3
+#endif
+
+// How long reserved blocks stay held back after the reservation's deadline.
+#ifndef RNG90_POOL_RESERVE_HOLD_MS
+#define RNG90_POOL_RESERVE_HOLD_MS 1000
+#endif
+
+static_assert(RNG90_POOL_SLOTS > 0 && RNG90_POOL_SLOTS <= 32, "RNG90_POOL_SLOTS must be 1 to 32");
+
+typedef enum {
+    RNG90_POOL_PRIORITY_NORMAL   = 0,
+    RNG90_POOL_PRIORITY_HIGH     = 1,
+    // Draws on the blocks set aside by rng90_pool_reserve().
+    RNG90_POOL_PRIORITY_RESERVED = 2
+} rng90_pool_priority_t;
+
+struct rng90_pool {
+    rng90_context_t* ctx;
+    // Bitmask of slots holding validated device output not yet handed out.
+    uint32_t ready;
+    // Bitmask of slots currently borrowed by consumers.
+    uint32_t borrowed;
+    // Number of ready blocks rng90_pool_service() maintains.
+    uint8_t target;
+    // Ready blocks only high priority requests may take.
+    uint8_t high_reserve;
+    // Blocks reserved by rng90_pool_reserve() and the time they are needed by.
+    uint8_t reserved;
+    absolute_time_t reserve_deadline;
+    bool auto_sleep;
+    // Demand tracking, see rng90_pool_set_adaptive().
+    bool adaptive;
+    uint8_t min_target;
+    uint8_t max_target;
+    uint8_t burst_blocks;
+    uint16_t burst_ewma;        // Blocks per burst, 8.8 fixed point.
+    uint32_t interval_ewma_us;  // Time between the starts of bursts.
+    absolute_time_t burst_start;
+    absolute_time_t last_acquire;
+    absolute_time_t next_refill;
+    uint32_t hits;
+    uint32_t misses;
+    // Health testing, see rng90_pool_set_monitor().
+    rng90_monitor_t* monitor;
+    uint64_t last_fold;
+    bool have_last;
+    bool health_failed;
+    uint8_t alarm_windows;
+    bool sleep_requested;
+    uint8_t slots[RNG90_POOL_SLOTS][RNG90_POOL_BLOCK_SIZE];
+};
+
+typedef struct rng90_pool rng90_pool_t;
+
+/**
+ * Initialise an empty pool of random blocks from the device identified by ctx.
+ *
+ * The pool is not thread safe. Once it is given to an async worker with
+ * rng90_async_set_pool(), every call on it must be made from that worker's
+ * async_context or with its lock held.
+ */
+void rng90_pool_init(rng90_pool_t* pool, rng90_context_t* ctx);
+
+/**
+ * Fill every slot which is neither ready nor borrowed from the device.
+ *
+ * Returns true if all free slots were filled, false on any device error.
+ */
+bool rng90_pool_refill(rng90_pool_t* pool);
+
+/**
+ * Borrow a ready 32 byte block from the pool without copying it.
+ *
+ * If no block is ready one is read from the device into a free slot first.
+ * The block must be returned with rng90_pool_release() once consumed.
+ *
+ * Returns true and sets *block on success, false if no slot is free or
+ * the device could not supply a block.
+ */
+bool rng90_pool_acquire(rng90_pool_t* pool, const uint8_t** block);
+
+/**
+ * Borrow a ready 32 byte block from the pool at the specified priority.
+ *
+ * Normal priority requests, including rng90_pool_acquire(), only take a ready
+ * block while more than the high priority reserve and any outstanding
+ * reservation are ready, otherwise they read a block from the device. Reserved
+ * priority requests may also take the reserved blocks, each one taken counts
+ * against the reservation. High priority requests may take any ready block.
+ */
+bool rng90_pool_acquire_priority(rng90_pool_t* pool, rng90_pool_priority_t priority, const uint8_t** block);
+
+/**
+ * Borrow a ready 32 byte block from the pool if one is available at the
+ * specified priority, without ever reading from the device.
+ *
+ * Returns false immediately if no block is ready.
+ */
+bool rng90_pool_try_acquire(rng90_pool_t* pool, rng90_pool_priority_t priority, const uint8_t** block);
+
+/**
+ * Return a block borrowed with rng90_pool_acquire(), rng90_pool_acquire_priority()
+ * or rng90_pool_try_acquire(), the slot is wiped
+ * before it becomes free for reuse.
+ */
+void rng90_pool_release(rng90_pool_t* pool, const uint8_t* block);
+
+/**
+ * Get the number of blocks ready to be borrowed.
+ */
+uint8_t rng90_pool_available(rng90_pool_t* pool);
+
+/**
+ * Set the number of ready blocks rng90_pool_service() maintains, by default
+ * every slot is kept filled.
+ */
+void rng90_pool_set_target(rng90_pool_t* pool, uint8_t target);
+
+/**
+ * Set the number of ready blocks held back for high priority requests.
+ *
+ * rng90_pool_service() always maintains at least this many ready blocks and
+ * restores them all in a single call, ahead of any other refill, so a high
+ * priority request only waits for the device if it arrives while the reserve
+ * itself is exhausted. Defaults to 0, at most RNG90_POOL_SLOTS - 1 so a normal
+ * priority request always has a slot to read a block from the device into.
+ */
+void rng90_pool_set_high_reserve(rng90_pool_t* pool, uint8_t blocks);
+
+/**
+ * Enable or disable putting the device to sleep from rng90_pool_service()
+ * once the pool has reached its target and no reservation is outstanding.
+ *
+ * Disabled by default.
+ */
+void rng90_pool_set_auto_sleep(rng90_pool_t* pool, bool enabled);
+
+/**
+ * Set a quality monitor every block is passed through before it becomes
+ * ready, pass NULL to remove it.
+ *
+ * Every block is also checked against the previous block. On a repeat or a
+ * monitor alarm the failing block and every ready block are wiped and the
+ * device is put to sleep by the next rng90_pool_service() or async worker
+ * pass to reset it. A repeat, or RNG90_POOL_ALARM_WINDOWS consecutive monitor
+ * windows with an alarm, marks the pool as failed and no further blocks
+ * become ready until rng90_pool_clear_health_failure() is called.
+ */
+void rng90_pool_set_monitor(rng90_pool_t* pool, rng90_monitor_t* monitor);
+
+/**
+ * Is the pool clear of a latched health test failure.
+ */
+bool rng90_pool_is_healthy(rng90_pool_t* pool);
+
+/**
+ * Clear a health test failure so the pool can be refilled again.
+ */
+void rng90_pool_clear_health_failure(rng90_pool_t* pool);
+
+/**
+ * Take a pending request from the health tests to put the device to sleep,
+ * the caller then calls rng90_sleep(). rng90_pool_service() and the async
+ * worker handle this themselves.
+ */
+bool rng90_pool_take_sleep_request(rng90_pool_t* pool);
+
+/**
+ * Enable or disable adaptive sizing of the pool.
+ *
+ * When enabled each acquisition is tracked, acquisitions less than
+ * RNG90_POOL_BURST_GAP_MS apart form a burst. Exponentially weighted moving
+ * averages of the burst size and the time between bursts set the target fill
+ * level, bounded by min_target and max_target, and the minimum time between
+ * refills from rng90_pool_service() so the target is restored just ahead of
+ * the next expected burst rather than as fast as possible.
+ */
+void rng90_pool_set_adaptive(rng90_pool_t* pool, bool enabled, uint8_t min_target, uint8_t max_target);
+
+/**
+ * Get the number of ready blocks rng90_pool_service() is currently maintaining.
+ */
+uint8_t rng90_pool_get_target(rng90_pool_t* pool);
+
+/**
+ * Get the fraction of acquisitions served from an already ready block.
+ *
+ * Returns 1.0 if nothing has been acquired yet.
+ */
+float rng90_pool_get_hit_ratio(rng90_pool_t* pool);
+
+/**
+ * Ask for bytes of random output to be ready in the pool by deadline.
+ *
+ * Until the deadline the fill level maintained by rng90_pool_service() is raised
+ * to cover the reservation, the device is kept awake, and refill is brought forward
+ * so the reserved blocks are read in time. The reserved blocks are only handed
+ * to RNG90_POOL_PRIORITY_RESERVED requests, and are held back from normal
+ * priority requests until they have been taken or RNG90_POOL_RESERVE_HOLD_MS
+ * after the deadline. They are held in addition to the high priority reserve,
+ * together capped at RNG90_POOL_SLOTS - 1 blocks like the high priority reserve.
+ * A new reservation replaces the last.
+ */
+void rng90_pool_reserve(rng90_pool_t* pool, size_t bytes, absolute_time_t deadline);
+
+/**
+ * Is the pool below its current target with a free slot to fill.
+ */
+bool rng90_pool_needs_refill(rng90_pool_t* pool);
+
+/**
+ * Claim a free slot to be filled outside of the pool, for example by the
+ * async_context worker. The slot must be returned with rng90_pool_end_fill().
+ *
+ * Returns NULL if no slot is free.
+ */
+uint8_t* rng90_pool_begin_fill(rng90_pool_t* pool);
+
+/**
+ * Return a slot claimed with rng90_pool_begin_fill(), marking it ready if
+ * success is true or wiping it otherwise.
+ */
+void rng90_pool_end_fill(rng90_pool_t* pool, uint8_t* block, bool success);
+
+/**
+ * Perform background refill of the pool, call regularly from the main loop.
+ *
+ * Normally at most one block is read from the device per call, with adaptive
+ * sizing enabled no more often than the current refill cadence. If a reservation
+ * would otherwise not be met by its deadline all blocks still needed for it are
+ * read in this call.
+ *
+ * Returns false on a device error.
+ */
+bool rng90_pool_service(rng90_pool_t* pool);
+
+#endif // RNG90_POOL_H
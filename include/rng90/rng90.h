@@ -22,6 +22,10 @@
 #include <stdint.h>
 
 #include "hardware/i2c.h"
+#include "pico/time.h"
+
+// Size of the unique device serial number returned by rng90_read_serial().
+#define RNG90_SERIAL_SIZE 9
 
 typedef enum {
     RNG90_SELFTEST_STATUS = 0x00,
@@ -41,6 +45,30 @@ typedef enum {
     RNG90_SELFTEST_COMM_ERROR    = 0xFF
 } rng90_selftest_result_t;
 
+typedef enum {
+    RNG90_POWER_AWAKE,
+    RNG90_POWER_SLEEP
+} rng90_power_mode_t;
+
+typedef enum {
+    RNG90_WAKE_DONE,
+    RNG90_WAKE_PENDING,
+    RNG90_WAKE_FAILED
+} rng90_wake_status_t;
+
+// Scheduling state flags packed into a single byte, see rng90_set_state_mirror().
+#define RNG90_STATE_INITIALIZED   0x01
+#define RNG90_STATE_SLEEPING      0x02
+#define RNG90_STATE_TEST_COMPLETE 0x04
+#define RNG90_STATE_PENDING       0x08
+
+/**
+ * Called while the driver waits on the device, with until the time the driver
+ * next needs the bus. The hook may use the bus for other devices but should
+ * return by until, the driver sleeps out any remaining time itself.
+ */
+typedef void (*rng90_wait_hook_t)(void* user_data, absolute_time_t until);
+
 struct rng90_context {
     i2c_inst_t* i2c_inst;
     bool initialized;
@@ -51,6 +79,19 @@ struct rng90_context {
     uint8_t silicon_rev;
     bool test_complete;
     bool logging;
+    bool speculative;
+    // A Random command has been issued and its response not yet read.
+    bool random_pending;
+    absolute_time_t random_ready_at;
+    absolute_time_t wake_started_at;
+    uint32_t wake_count;
+    uint32_t wake_latency_us;
+    uint32_t wake_latency_max_us;
+    rng90_wait_hook_t wait_hook;
+    void* wait_hook_data;
+    uint8_t* mirror_state;
+    uint8_t* mirror_pending;
+    uint32_t* mirror_deadline;
 };
 
 typedef struct rng90_context rng90_context_t;
@@ -80,11 +121,23 @@ bool rng90_is_initialized(rng90_context_t* ctx);
  */
 bool rng90_is_sleeping(rng90_context_t* ctx);
 
+/**
+ * Enable or disable speculative issue of Random commands.
+ *
+ * Speculation is disabled by default. When enabled, rng90_random() issues the
+ * next Random command as soon as it has read its last response so the device
+ * computes the next block while the caller is busy, the next call then only
+ * has to read the waiting response. Any other command, including sleep, first
+ * waits for a speculative command to complete and discards its result.
+ */
+void rng90_set_speculative(rng90_context_t* ctx, bool enabled);
+
 /**
  * Initialize the RNG90 device.
  *
  * Wake up the device if sleeping and load info
- * from device.
+ * from device. The wake is checked and counted as in
+ * rng90_wake_poll().
  */
 void rng90_init(rng90_context_t* ctx);
 
@@ -93,6 +146,22 @@ void rng90_init(rng90_context_t* ctx);
  */
 void rng90_sleep(rng90_context_t* ctx);
 
+/**
+ * Put the device into the lower energy state for an expected idle period.
+ *
+ * Both sleep word addresses (0x01 and 0x02) reset the device, so there is no
+ * idle mode preserving the self-test state. The choice is between staying
+ * awake at the I/O current of 60-250 uA, or sleeping at 130 nA and paying the
+ * wake (tPU 1.0-1.8 ms) and the self-tests run by the next Random command
+ * (about 37-47 ms extra at 0.75 mA). That comes to about 37 uC, which matches
+ * the worst case awake current after about 150 ms. Shorter gaps stay awake,
+ * which is better for both energy and latency. Longer gaps sleep, which saves
+ * energy at a latency cost of up to about 49 ms on the next request.
+ *
+ * Returns the mode the device was left in.
+ */
+rng90_power_mode_t rng90_power_down(rng90_context_t* ctx, uint32_t expected_idle_ms);
+
 /**
  * Get the RFU (Reserved for Future Use) value from the device info.
  */
@@ -113,6 +182,38 @@ uint8_t rng90_get_silicon_id(rng90_context_t* ctx);
  */
 uint8_t rng90_get_silicon_rev(rng90_context_t* ctx);
 
+/**
+ * Get the number of times the device has been woken from sleep, including by rng90_init().
+ */
+uint32_t rng90_get_wake_count(rng90_context_t* ctx);
+
+/**
+ * Get the time in microseconds from the wake pulse to reading the wake
+ * response for the most recent automatic wake.
+ */
+uint32_t rng90_get_wake_latency_us(rng90_context_t* ctx);
+
+/**
+ * Get the longest automatic wake latency in microseconds.
+ */
+uint32_t rng90_get_wake_latency_max_us(rng90_context_t* ctx);
+
+/**
+ * Set a hook called in place of sleeping while waiting for a Random command to
+ * complete or for the device to wake, pass NULL to remove it. The hook must
+ * not call back into the driver for the same device.
+ */
+void rng90_set_wait_hook(rng90_context_t* ctx, rng90_wait_hook_t hook, void* user_data);
+
+/**
+ * Have the driver keep a packed copy of its scheduling state up to date,
+ * written whenever the state changes. state receives RNG90_STATE_ flags,
+ * pending the opcode of the command the device is executing or 0x00, and
+ * deadline the time_us_32() value the response is due. Pass NULL for state
+ * to stop, otherwise all three must be valid.
+ */
+void rng90_set_state_mirror(rng90_context_t* ctx, uint8_t* state, uint8_t* pending, uint32_t* deadline);
+
 /**
  * Run or query a self-test on the RNG90 device.
  *
@@ -129,12 +230,63 @@ const char* rng90_selftest_result_str(rng90_selftest_result_t result);
  * Generate random bytes from the RNG90 device.
  *
  * Fills buf with len random bytes, calling the device as many times
- * as necessary (32 bytes per call). If the device is sleeping, it
- * will be woken automatically. Self-test status is checked to
- * determine appropriate timing for the first call.
+ * as necessary (32 bytes per call). Each command is issued as soon as
+ * the previous response has been read, so the device is already working
+ * on the next block while the last one is validated and copied. If the
+ * device is sleeping, it will be woken automatically. Self-test status
+ * is checked to determine appropriate timing for the first call.
  *
  * Returns true on success, false on any communication or CRC error.
  */
 bool rng90_random(rng90_context_t* ctx, uint8_t* buf, size_t len);
 
+/*
+ * Split phase operation, for callers which schedule their own waiting such as
+ * the async_context worker. None of these functions wait for the device other
+ * than for the duration of a single I2C transfer.
+ */
+
+/**
+ * Send the wake pulse to a sleeping device, the wake then completes by calling
+ * rng90_wake_poll() until it no longer returns RNG90_WAKE_PENDING.
+ */
+void rng90_wake_start(rng90_context_t* ctx);
+
+/**
+ * Check for the wake response, the device takes 1.0-1.8 ms to power up.
+ */
+rng90_wake_status_t rng90_wake_poll(rng90_context_t* ctx);
+
+/**
+ * Issue a Random command to an awake device, if a command is already pending
+ * (such as a speculative one) that command is used instead.
+ *
+ * Returns false if the device is not initialized, is sleeping or on a write error.
+ */
+bool rng90_random_start(rng90_context_t* ctx);
+
+/**
+ * Get the time the pending Random command is expected to complete.
+ */
+absolute_time_t rng90_random_ready_at(rng90_context_t* ctx);
+
+/**
+ * Read and validate the result of the pending Random command, copying up to
+ * 32 bytes into buf. Should be called at or after rng90_random_ready_at(), if
+ * called earlier it waits for that time.
+ *
+ * Returns true on success, false on any communication, CRC or device error.
+ */
+bool rng90_random_finish(rng90_context_t* ctx, uint8_t* buf, size_t len);
+
+/**
+ * Read the unique 72-bit serial number of the RNG90 device.
+ *
+ * Writes RNG90_SERIAL_SIZE bytes to serial. If the device is sleeping,
+ * it will be woken automatically.
+ *
+ * Returns true on success, false on any communication or CRC error.
+ */
+bool rng90_read_serial(rng90_context_t* ctx, uint8_t* serial);
+
 #endif // RNG90_RNG90_H
\ No newline at end of file
@@ -0,0 +1,398 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RNG90_RNG90_HPP
+#define RNG90_RNG90_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+extern "C" {
+#include "rng90/frames.h"
+#include "rng90/pool.h"
+#include "rng90/rng90.h"
+}
+
+namespace rng90 {
+
+/**
+ * CRC-16 as calculated by rng90_crc16(), usable in constant expressions.
+ */
+constexpr std::uint16_t crc16(const std::uint8_t* data, std::size_t length)
+{
+    std::uint16_t remainder = 0x0000;
+    for (std::size_t pos = 0; pos < length; ++pos)
+    {
+        remainder ^= data[pos];
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            remainder = (remainder & 0x0001) ? (remainder >> 1) ^ 0xA001 : (remainder >> 1);
+        }
+    }
+
+    std::uint16_t reflection = 0x0000;
+    for (int bit = 0; bit < 16; ++bit)
+    {
+        if (remainder & (1 << bit))
+        {
+            reflection |= static_cast<std::uint16_t>(1 << (15 - bit));
+        }
+    }
+    return reflection;
+}
+
+/**
+ * Build a complete command as written to the bus, word address through
+ * CRC, with DataLength zeroed data bytes, at compile time.
+ */
+template <std::uint8_t Opcode, std::uint8_t Param1, std::size_t DataLength = 0>
+constexpr std::array<std::uint8_t, 8 + DataLength> command_frame()
+{
+    static_assert(7 + DataLength <= 0xFF, "command too long");
+
+    std::array<std::uint8_t, 8 + DataLength> frame{};
+    frame[0] = 0x03; // Command word address
+    frame[1] = static_cast<std::uint8_t>(7 + DataLength);
+    frame[2] = Opcode;
+    frame[3] = Param1;
+
+    std::uint16_t crc = crc16(&frame[1], 5 + DataLength);
+    frame[6 + DataLength] = static_cast<std::uint8_t>(crc & 0xFF);
+    frame[7 + DataLength] = static_cast<std::uint8_t>(crc >> 8);
+    return frame;
+}
+
+namespace detail {
+
+template <std::size_t N>
+constexpr bool same_frame(const std::array<std::uint8_t, N>& built, const std::array<std::uint8_t, N>& fixed)
+{
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        if (built[i] != fixed[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace detail
+
+// The C driver writes these precomputed frames, check them against the constexpr CRC.
+static_assert(detail::same_frame(command_frame<0x30, 0x00>(),
+    std::array<std::uint8_t, RNG90_FRAME_INFO_SIZE>RNG90_FRAME_INFO), "Info command frame");
+static_assert(detail::same_frame(command_frame<0x16, 0x00, 20>(),
+    std::array<std::uint8_t, RNG90_FRAME_RANDOM_SIZE>RNG90_FRAME_RANDOM), "Random command frame");
+static_assert(detail::same_frame(command_frame<0x02, 0x01>(),
+    std::array<std::uint8_t, RNG90_FRAME_READ_SERIAL_SIZE>RNG90_FRAME_READ_SERIAL), "Read serial command frame");
+
+/**
+ * Transport using one of the RP2040 hardware I2C instances.
+ */
+template <unsigned Index>
+struct hw_i2c {
+    static_assert(Index < 2, "the RP2040 has two I2C instances");
+
+    static i2c_inst_t* instance()
+    {
+        return Index == 0 ? i2c0 : i2c1;
+    }
+};
+
+/**
+ * Timing policies, selecting how the device waits for a Random command to
+ * complete or for the device to wake.
+ *
+ * sleep_timing leaves the driver to sleep_until(). poll_timing spins on the
+ * timer instead, for callers that can't be descheduled while the device
+ * works. A custom policy provides static void wait(absolute_time_t until),
+ * which is installed as the driver's wait hook. sleep_timing installs no
+ * hook, so it costs nothing over the C driver.
+ */
+struct sleep_timing {
+};
+
+struct poll_timing {
+    static void wait(absolute_time_t until)
+    {
+        busy_wait_until(until);
+    }
+};
+
+/**
+ * Logging policies, selecting whether the device enables the driver's logging.
+ *
+ * The logging code lives in the C driver, so the policy can only choose the
+ * runtime setting. Compiling the logging out takes building the library
+ * with RNG90_LOGGING off. In that build no_log leaves nothing behind, and
+ * stdout_log is rejected at compile time.
+ */
+struct no_log {
+    static constexpr bool enabled = false;
+};
+
+struct stdout_log {
+    static constexpr bool enabled = true;
+};
+
+/**
+ * Pool policies, selecting whether the device owns an entropy pool.
+ *
+ * The C pool's slots are sized when the library is built, so
+ * pool_slots<N> only checks N against RNG90_POOL_SLOTS. no_pool adds
+ * nothing to the device.
+ */
+struct no_pool {
+    static constexpr std::size_t slots = 0;
+};
+
+template <std::size_t Slots>
+struct pool_slots {
+    static_assert(Slots == RNG90_POOL_SLOTS, "pool size must match RNG90_POOL_SLOTS from the library build");
+    static constexpr std::size_t slots = Slots;
+};
+
+namespace detail {
+
+template <typename Timing, typename = void>
+struct has_wait : std::false_type {
+};
+
+template <typename Timing>
+struct has_wait<Timing, std::void_t<decltype(Timing::wait(std::declval<absolute_time_t>()))>> : std::true_type {
+};
+
+template <typename Timing>
+void wait_hook(void*, absolute_time_t until)
+{
+    Timing::wait(until);
+}
+
+} // namespace detail
+
+/**
+ * Fill size bytes at data with random bytes from the device.
+ */
+inline bool fill(rng90_context_t* ctx, std::byte* data, std::size_t size)
+{
+    return rng90_random(ctx, reinterpret_cast<std::uint8_t*>(data), size);
+}
+
+/**
+ * Fill any contiguous range of byte sized elements, such as std::span<std::byte>,
+ * std::array<std::uint8_t, N> or std::vector<std::byte>, with random bytes.
+ */
+template <typename Range>
+bool fill(rng90_context_t* ctx, Range&& range)
+{
+    using element = std::remove_pointer_t<decltype(std::data(range))>;
+    static_assert(sizeof(element) == 1 && std::is_trivially_copyable_v<element>,
+        "range elements must be single bytes");
+    static_assert(!std::is_const_v<element>, "range must be writable");
+
+    return fill(ctx, reinterpret_cast<std::byte*>(std::data(range)), std::size(range));
+}
+
+/**
+ * A move-only handle to a 32 byte block borrowed from an rng90_pool_t.
+ *
+ * The block is read in place from the pool slot, the slot is released and
+ * wiped when the handle is destroyed or assigned over. Moving the handle
+ * transfers ownership of the slot without copying the block.
+ */
+class entropy_block {
+public:
+    static constexpr std::size_t size_bytes = RNG90_POOL_BLOCK_SIZE;
+
+    entropy_block() = default;
+
+    explicit entropy_block(rng90_pool_t* pool, rng90_pool_priority_t priority = RNG90_POOL_PRIORITY_NORMAL)
+    {
+        if (rng90_pool_acquire_priority(pool, priority, &block_))
+        {
+            pool_ = pool;
+        }
+    }
+
+    entropy_block(const entropy_block&) = delete;
+    entropy_block& operator=(const entropy_block&) = delete;
+
+    entropy_block(entropy_block&& other) noexcept
+        : pool_(std::exchange(other.pool_, nullptr)), block_(std::exchange(other.block_, nullptr))
+    {
+    }
+
+    entropy_block& operator=(entropy_block&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            pool_ = std::exchange(other.pool_, nullptr);
+            block_ = std::exchange(other.block_, nullptr);
+        }
+        return *this;
+    }
+
+    ~entropy_block()
+    {
+        release();
+    }
+
+    explicit operator bool() const { return pool_ != nullptr; }
+
+    const std::uint8_t* data() const { return block_; }
+    std::size_t size() const { return pool_ ? size_bytes : 0; }
+
+    const std::uint8_t* begin() const { return data(); }
+    const std::uint8_t* end() const { return data() + size(); }
+
+    /**
+     * Return the slot to the pool early.
+     */
+    void release()
+    {
+        if (pool_)
+        {
+            rng90_pool_release(pool_, block_);
+            pool_ = nullptr;
+            block_ = nullptr;
+        }
+    }
+
+private:
+    rng90_pool_t* pool_ = nullptr;
+    const std::uint8_t* block_ = nullptr;
+};
+
+/**
+ * A pool of random blocks from a device, blocks are borrowed as entropy_block handles.
+ */
+class pool {
+public:
+    explicit pool(rng90_context_t* ctx)
+    {
+        rng90_pool_init(&pool_, ctx);
+    }
+
+    pool(const pool&) = delete;
+    pool& operator=(const pool&) = delete;
+
+    bool refill() { return rng90_pool_refill(&pool_); }
+    std::uint8_t available() { return rng90_pool_available(&pool_); }
+
+    entropy_block acquire(rng90_pool_priority_t priority = RNG90_POOL_PRIORITY_NORMAL)
+    {
+        return entropy_block(&pool_, priority);
+    }
+
+    /**
+     * The underlying C pool, for use with the rng90_pool_ functions.
+     */
+    rng90_pool_t* c_pool() { return &pool_; }
+
+private:
+    rng90_pool_t pool_;
+};
+
+namespace detail {
+
+template <bool Enabled>
+struct pool_holder {
+    explicit pool_holder(rng90_context_t*) {}
+};
+
+template <>
+struct pool_holder<true> {
+    explicit pool_holder(rng90_context_t* ctx) : pool_(ctx) {}
+
+    rng90::pool pool_;
+};
+
+} // namespace detail
+
+/**
+ * An RNG90 device with its transport, timing, logging and pool fixed at
+ * compile time, e.g. device<hw_i2c<0>, poll_timing, no_log, pool_slots<8>>.
+ */
+template <typename Transport, typename Timing = sleep_timing, typename Log = no_log, typename Pool = no_pool>
+class device : private detail::pool_holder<(Pool::slots > 0)> {
+#if defined(RNG90_LOGGING)
+    static_assert(!Log::enabled || RNG90_LOGGING, "logging policy requires the driver built with RNG90_LOGGING");
+#endif
+
+    // The pool only keeps the context's address, so it may be constructed first.
+    using pool_base = detail::pool_holder<(Pool::slots > 0)>;
+
+public:
+    device() : pool_base(&ctx_)
+    {
+        rng90_set_i2c_instance(&ctx_, Transport::instance());
+        if constexpr (detail::has_wait<Timing>::value)
+        {
+            rng90_set_wait_hook(&ctx_, &detail::wait_hook<Timing>, nullptr);
+        }
+        if constexpr (Log::enabled)
+        {
+            rng90_set_logging(&ctx_, true);
+        }
+    }
+
+    device(const device&) = delete;
+    device& operator=(const device&) = delete;
+
+    void init() { rng90_init(&ctx_); }
+    void sleep() { rng90_sleep(&ctx_); }
+
+    bool is_initialized() { return rng90_is_initialized(&ctx_); }
+    bool is_sleeping() { return rng90_is_sleeping(&ctx_); }
+
+    std::uint8_t device_id() { return rng90_get_device_id(&ctx_); }
+    std::uint8_t silicon_id() { return rng90_get_silicon_id(&ctx_); }
+    std::uint8_t silicon_rev() { return rng90_get_silicon_rev(&ctx_); }
+
+    rng90_selftest_result_t self_test(rng90_selftest_type_t type) { return rng90_self_test(&ctx_, type); }
+    bool random(std::uint8_t* buf, std::size_t len) { return rng90_random(&ctx_, buf, len); }
+    template <typename Range>
+    bool fill(Range&& range) { return rng90::fill(&ctx_, std::forward<Range>(range)); }
+
+    bool read_serial(std::array<std::uint8_t, RNG90_SERIAL_SIZE>& serial) { return rng90_read_serial(&ctx_, serial.data()); }
+
+    /**
+     * The device's entropy pool, only available with a pool_slots<> policy.
+     */
+    rng90::pool& entropy_pool()
+    {
+        static_assert(Pool::slots > 0, "device declared with no_pool");
+        return this->pool_;
+    }
+
+    /**
+     * The underlying C context, for use with the other rng90_ modules.
+     */
+    rng90_context_t* context() { return &ctx_; }
+
+private:
+    rng90_context_t ctx_;
+};
+
+} // namespace rng90
+
+#endif // RNG90_RNG90_HPP
@@ -0,0 +1,55 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RNG90_SHA256_H
+#define RNG90_SHA256_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define RNG90_SHA256_BLOCK_SIZE 64
+#define RNG90_SHA256_DIGEST_SIZE 32
+
+struct rng90_sha256_context {
+    uint32_t state[8];
+    uint64_t length;
+    uint8_t block[RNG90_SHA256_BLOCK_SIZE];
+    uint8_t block_len;
+};
+
+typedef struct rng90_sha256_context rng90_sha256_context_t;
+
+/**
+ * Start a SHA-256 calculation.
+ */
+void rng90_sha256_init(rng90_sha256_context_t* ctx);
+
+/**
+ * Bring the next length bytes into a SHA-256 calculation.
+ *
+ * Whole 64 byte blocks are compressed directly from data without being
+ * buffered in the context.
+ */
+void rng90_sha256_update(rng90_sha256_context_t* ctx, const uint8_t* data, size_t length);
+
+/**
+ * Complete a SHA-256 calculation and write the 32 byte digest.
+ *
+ * The context is cleared and must be initialised again before re-use.
+ */
+void rng90_sha256_final(rng90_sha256_context_t* ctx, uint8_t* digest);
+
+#endif // RNG90_SHA256_H
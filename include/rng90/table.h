@@ -0,0 +1,76 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RNG90_TABLE_H
+#define RNG90_TABLE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "hardware/i2c.h"
+
+#include "rng90/rng90.h"
+
+#ifndef RNG90_TABLE_SIZE
+#define RNG90_TABLE_SIZE 4
+#endif
+
+/*
+ * The table is laid out as a struct of arrays, the fields a scheduler scans
+ * on every pass are kept together at the start so a scan over all devices
+ * touches as little memory as possible, the full contexts are
+ * only touched once a device has been selected.
+ *
+ * The hot fields are written by the driver itself through its state mirror,
+ * so they are current after every rng90_ call without any bookkeeping.
+ */
+struct rng90_table {
+    // Hot fields, RNG90_STATE_ flags, pending opcode and response deadline.
+    uint8_t state[RNG90_TABLE_SIZE];
+    uint8_t pending[RNG90_TABLE_SIZE];
+    uint32_t deadline[RNG90_TABLE_SIZE];
+    uint8_t count;
+    // Cold fields.
+    rng90_context_t contexts[RNG90_TABLE_SIZE];
+};
+
+typedef struct rng90_table rng90_table_t;
+
+/**
+ * Initialise an empty device table.
+ */
+void rng90_table_init(rng90_table_t* table);
+
+/**
+ * Add a device on the specified I2C instance to the table.
+ *
+ * Returns the index of the device or -1 if the table is full.
+ */
+int rng90_table_add(rng90_table_t* table, i2c_inst_t* i2c_inst);
+
+/**
+ * Get the context of the device at index for use with the rng90_ functions.
+ */
+rng90_context_t* rng90_table_context(rng90_table_t* table, uint8_t index);
+
+/**
+ * Find the device with the earliest pending deadline at or before now.
+ *
+ * Returns the index of the device or -1 if no pending response is due.
+ */
+int rng90_table_next_due(rng90_table_t* table, uint32_t now);
+
+#endif // RNG90_TABLE_H
@@ -0,0 +1,30 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RNG90_WIPE_H
+#define RNG90_WIPE_H
+
+#include <stddef.h>
+
+/**
+ * Zero length bytes at data in a way the compiler can not remove, even
+ * when the buffer is not read again before it goes out of scope.
+ *
+ * The aligned part of the buffer is cleared a word at a time.
+ */
+void rng90_secure_wipe(void* data, size_t length);
+
+#endif // RNG90_WIPE_H
@@ -0,0 +1,157 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+
+#include "pico/rand.h"
+
+#include "rng90/mixer.h"
+#include "rng90/wipe.h"
+#include "rng90_log.h"
+
+#define DEVICE_BLOCK_SIZE 32
+
+#define EXTRACT_STATE 0x00
+#define EXTRACT_OUTPUT 0x01
+
+// Internal Function Definitions
+static void add_platform_bits(rng90_sha256_context_t* sha, uint32_t bits);
+static void extract(const uint8_t* seed, uint8_t tag, uint8_t* out);
+static bool device_block(rng90_mixer_t* mixer, uint8_t* block);
+
+void rng90_mixer_init(rng90_mixer_t* mixer, rng90_context_t* ctx)
+{
+    mixer->ctx = ctx;
+    mixer->counter = 0;
+    mixer->device_available = true;
+    mixer->retry_at = get_absolute_time();
+
+    rng90_sha256_context_t sha;
+    rng90_sha256_init(&sha);
+    add_platform_bits(&sha, RNG90_MIXER_FALLBACK_BITS);
+    rng90_sha256_final(&sha, mixer->state);
+}
+
+bool rng90_mixer_random(rng90_mixer_t* mixer, uint8_t* buf, size_t len)
+{
+    uint8_t block[DEVICE_BLOCK_SIZE];
+    uint8_t seed[RNG90_SHA256_DIGEST_SIZE];
+    rng90_sha256_context_t sha;
+    bool all_device = true;
+
+    size_t offset = 0;
+    while (offset < len)
+    {
+        rng90_sha256_init(&sha);
+        rng90_sha256_update(&sha, mixer->state, sizeof(mixer->state));
+        rng90_sha256_update(&sha, (const uint8_t*)&mixer->counter, sizeof(mixer->counter));
+        ++mixer->counter;
+
+        if (device_block(mixer, block))
+        {
+            rng90_sha256_update(&sha, block, sizeof(block));
+            add_platform_bits(&sha, RNG90_MIXER_SUPPLEMENT_BITS);
+        }
+        else
+        {
+            add_platform_bits(&sha, RNG90_MIXER_FALLBACK_BITS);
+            all_device = false;
+        }
+        rng90_sha256_final(&sha, seed);
+
+        // Separate the next state from the output so output never reveals the state.
+        extract(seed, EXTRACT_STATE, mixer->state);
+
+        size_t to_copy = len - offset;
+        if (to_copy >= RNG90_SHA256_DIGEST_SIZE)
+        {
+            extract(seed, EXTRACT_OUTPUT, &buf[offset]);
+            to_copy = RNG90_SHA256_DIGEST_SIZE;
+        }
+        else
+        {
+            extract(seed, EXTRACT_OUTPUT, block);
+            memcpy(&buf[offset], block, to_copy);
+        }
+        offset += to_copy;
+    }
+
+    rng90_secure_wipe(block, sizeof(block));
+    rng90_secure_wipe(seed, sizeof(seed));
+    rng90_secure_wipe(&sha, sizeof(sha));
+
+    return all_device;
+}
+
+bool rng90_mixer_is_device_available(rng90_mixer_t* mixer)
+{
+    return mixer->device_available;
+}
+
+// Internal function implementations
+
+/*
+ * Gather bits from pico_rand 128 at a time. pico_rand is a non-cryptographic
+ * PRNG seeded from the ring oscillator, timers and board ID, so a call's 128
+ * bits carry much less entropy than that. Asking for more bits hashes in
+ * more of its state, it does not make the result as strong as a device block.
+ */
+static void add_platform_bits(rng90_sha256_context_t* sha, uint32_t bits)
+{
+    for (uint32_t pos = 0; pos < bits; pos += 128)
+    {
+        rng128_t value;
+        get_rand_128(&value);
+        rng90_sha256_update(sha, (const uint8_t*)value.r, sizeof(value.r));
+        rng90_secure_wipe(&value, sizeof(value));
+    }
+}
+
+static void extract(const uint8_t* seed, uint8_t tag, uint8_t* out)
+{
+    rng90_sha256_context_t sha;
+
+    rng90_sha256_init(&sha);
+    rng90_sha256_update(&sha, &tag, 1);
+    rng90_sha256_update(&sha, seed, RNG90_SHA256_DIGEST_SIZE);
+    rng90_sha256_final(&sha, out);
+}
+
+static bool device_block(rng90_mixer_t* mixer, uint8_t* block)
+{
+    if (!mixer->device_available && !time_reached(mixer->retry_at))
+    {
+        return false;
+    }
+
+    if (rng90_random(mixer->ctx, block, DEVICE_BLOCK_SIZE))
+    {
+        if (!mixer->device_available)
+        {
+            rng90_log(mixer->ctx, "RNG90 mixer: device recovered\n");
+            mixer->device_available = true;
+        }
+        return true;
+    }
+
+    // A sleep/wake cycle clears health test failures, the next attempt wakes the device.
+    rng90_log(mixer->ctx, "RNG90 mixer: device failed, using fallback for %d ms\n", RNG90_MIXER_RETRY_MS);
+    rng90_sleep(mixer->ctx);
+    mixer->device_available = false;
+    mixer->retry_at = make_timeout_time_ms(RNG90_MIXER_RETRY_MS);
+
+    return false;
+}
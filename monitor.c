@@ -0,0 +1,162 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+
+#include "rng90/monitor.h"
+
+// Internal Function Definitions
+static void reset_window(rng90_monitor_t* mon);
+static void evaluate_window(rng90_monitor_t* mon);
+static bool outside_sigma(int64_t deviation, uint64_t variance_x4, uint8_t sigma);
+
+void rng90_monitor_init(rng90_monitor_t* mon)
+{
+    memset(mon, 0x00, sizeof(*mon));
+    mon->chi_square_limit = RNG90_MONITOR_CHI_SQUARE_LIMIT_DEFAULT;
+    mon->sigma_limit = RNG90_MONITOR_SIGMA_LIMIT_DEFAULT;
+}
+
+uint8_t rng90_monitor_update(rng90_monitor_t* mon, const uint8_t* block)
+{
+    uint8_t previous = mon->last_byte;
+    bool first = mon->blocks == 0;
+
+    for (uint8_t pos = 0; pos < RNG90_MONITOR_BLOCK_SIZE; pos += 4)
+    {
+        // Treat the stream as bytes MSB first, loading a word at a time.
+        uint32_t word = ((uint32_t)block[pos] << 24) | ((uint32_t)block[pos + 1] << 16) |
+                        ((uint32_t)block[pos + 2] << 8) | (uint32_t)block[pos + 3];
+
+        mon->ones += __builtin_popcount(word);
+        // Bit transitions within the word plus the one from the previous byte.
+        mon->transitions += __builtin_popcount((word ^ (word >> 1)) & 0x7FFFFFFF);
+        if (!first || pos > 0)
+        {
+            mon->transitions += ((previous ^ (word >> 31)) & 0x01);
+        }
+
+        for (uint8_t i = 0; i < 4; ++i)
+        {
+            uint8_t value = block[pos + i];
+            ++mon->histogram[value];
+            mon->sum += value;
+            mon->sum_squares += (uint32_t)value * value;
+            if (!first || pos > 0 || i > 0)
+            {
+                mon->sum_products += (uint32_t)previous * value;
+            }
+            previous = value;
+        }
+    }
+    mon->last_byte = previous;
+
+    if (++mon->blocks < RNG90_MONITOR_WINDOW_BLOCKS)
+    {
+        return RNG90_MONITOR_ALARM_NONE;
+    }
+
+    evaluate_window(mon);
+    reset_window(mon);
+
+    return mon->window.alarms;
+}
+
+const rng90_monitor_window_t* rng90_monitor_get_window(rng90_monitor_t* mon)
+{
+    return &mon->window;
+}
+
+// Internal function implementations
+
+static void reset_window(rng90_monitor_t* mon)
+{
+    memset(mon->histogram, 0x00, sizeof(mon->histogram));
+    mon->blocks = 0;
+    mon->ones = 0;
+    mon->transitions = 0;
+    mon->sum = 0;
+    mon->sum_squares = 0;
+    mon->sum_products = 0;
+    mon->last_byte = 0;
+}
+
+/*
+ * Everything here runs once per window so the floating point use is
+ * kept out of the per block path.
+ */
+static void evaluate_window(rng90_monitor_t* mon)
+{
+    rng90_monitor_window_t* window = &mon->window;
+    uint32_t bytes = (uint32_t)mon->blocks * RNG90_MONITOR_BLOCK_SIZE;
+    uint32_t bits = bytes * 8;
+
+    // Chi-square against a uniform distribution: (256 / N) * sum(h^2) - N
+    uint64_t sum_counts_squared = 0;
+    for (uint16_t value = 0; value < 256; ++value)
+    {
+        sum_counts_squared += (uint32_t)mon->histogram[value] * mon->histogram[value];
+    }
+
+    window->bytes = bytes;
+    window->chi_square = (float)((double)sum_counts_squared * 256.0 / bytes - bytes);
+    window->ones = mon->ones;
+    window->runs = mon->transitions + 1;
+    window->alarms = RNG90_MONITOR_ALARM_NONE;
+
+    if (window->chi_square > mon->chi_square_limit)
+    {
+        window->alarms |= RNG90_MONITOR_ALARM_CHI_SQUARE;
+    }
+
+    // Ones ~ Binomial(n, 1/2) so 4 * variance = n, transitions ~ Binomial(n - 1, 1/2).
+    if (outside_sigma(2 * (int64_t)mon->ones - bits, bits, mon->sigma_limit))
+    {
+        window->alarms |= RNG90_MONITOR_ALARM_BIT_BALANCE;
+    }
+    if (outside_sigma(2 * (int64_t)mon->transitions - (bits - 1), bits - 1, mon->sigma_limit))
+    {
+        window->alarms |= RNG90_MONITOR_ALARM_RUNS;
+    }
+
+    // Lag-1 serial correlation of the bytes, close to zero for random data.
+    double n = (double)(bytes - 1);
+    double mean = (double)mon->sum / bytes;
+    double variance = (double)mon->sum_squares / bytes - mean * mean;
+    double covariance = (double)mon->sum_products / n - mean * mean;
+    window->serial_correlation = variance > 0.0 ? (float)(covariance / variance) : 1.0f;
+
+    float limit = (float)mon->sigma_limit;
+    if (window->serial_correlation * window->serial_correlation * (float)n > limit * limit)
+    {
+        window->alarms |= RNG90_MONITOR_ALARM_SERIAL;
+    }
+
+    ++mon->windows;
+    if (window->alarms != RNG90_MONITOR_ALARM_NONE)
+    {
+        ++mon->alarm_windows;
+    }
+}
+
+/*
+ * Compares |deviation / 2| > sigma * sqrt(variance) without a square root,
+ * both sides having been scaled by 2 by the caller.
+ */
+static bool outside_sigma(int64_t deviation, uint64_t variance_x4, uint8_t sigma)
+{
+    return (uint64_t)(deviation * deviation) > (uint64_t)sigma * sigma * variance_x4;
+}
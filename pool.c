@@ -0,0 +1,550 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+
+#include "rng90/pool.h"
+#include "rng90/wipe.h"
+#include "rng90_log.h"
+
+#define ALL_SLOTS ((uint32_t)(((uint64_t)1 << RNG90_POOL_SLOTS) - 1))
+
+// Time to read a block, Random takes 20.2-25.3 ms and up to 72 ms including self-tests.
+#define BLOCK_TIME_MS 30
+#define FIRST_BLOCK_TIME_MS 75
+
+// EWMA weight of each new sample is 1 / EWMA_WEIGHT. The differences are signed,
+// so they are divided rather than shifted, a right shift of a negative value is
+// implementation defined.
+#define EWMA_WEIGHT 8
+
+// Internal Function Definitions
+static int free_slot(rng90_pool_t* pool);
+static bool fill_slot(rng90_pool_t* pool, uint8_t slot);
+static bool reservation_active(rng90_pool_t* pool);
+static void track_demand(rng90_pool_t* pool, bool hit);
+static void adapt(rng90_pool_t* pool);
+static bool has_ready_block(rng90_pool_t* pool, rng90_pool_priority_t priority);
+static void take_block(rng90_pool_t* pool, rng90_pool_priority_t priority, const uint8_t** block);
+static uint8_t effective_target(rng90_pool_t* pool, bool* reserving);
+static uint8_t reservation_target(rng90_pool_t* pool);
+static bool accept_block(rng90_pool_t* pool, uint8_t slot);
+static bool health_check(rng90_pool_t* pool, const uint8_t* block);
+
+void rng90_pool_init(rng90_pool_t* pool, rng90_context_t* ctx)
+{
+    memset(pool, 0x00, sizeof(*pool));
+    pool->ctx = ctx;
+    pool->target = RNG90_POOL_SLOTS;
+    pool->auto_sleep = false;
+}
+
+bool rng90_pool_refill(rng90_pool_t* pool)
+{
+    int slot;
+    while ((slot = free_slot(pool)) >= 0)
+    {
+        if (!fill_slot(pool, (uint8_t)slot))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool rng90_pool_acquire(rng90_pool_t* pool, const uint8_t** block)
+{
+    return rng90_pool_acquire_priority(pool, RNG90_POOL_PRIORITY_NORMAL, block);
+}
+
+bool rng90_pool_acquire_priority(rng90_pool_t* pool, rng90_pool_priority_t priority, const uint8_t** block)
+{
+    bool hit = has_ready_block(pool, priority);
+
+    track_demand(pool, hit);
+
+    if (!hit)
+    {
+        int slot = free_slot(pool);
+        if (slot < 0)
+        {
+            rng90_log(pool->ctx, "RNG90 pool: all slots borrowed\n");
+            return false;
+        }
+
+        if (!fill_slot(pool, (uint8_t)slot))
+        {
+            return false;
+        }
+    }
+
+    take_block(pool, priority, block);
+
+    return true;
+}
+
+bool rng90_pool_try_acquire(rng90_pool_t* pool, rng90_pool_priority_t priority, const uint8_t** block)
+{
+    bool hit = has_ready_block(pool, priority);
+
+    track_demand(pool, hit);
+
+    if (!hit)
+    {
+        return false;
+    }
+
+    take_block(pool, priority, block);
+
+    return true;
+}
+
+void rng90_pool_release(rng90_pool_t* pool, const uint8_t* block)
+{
+    size_t slot = (size_t)(block - &pool->slots[0][0]) / RNG90_POOL_BLOCK_SIZE;
+    if (slot >= RNG90_POOL_SLOTS || !(pool->borrowed & (1u << slot)))
+    {
+        return;
+    }
+
+    rng90_secure_wipe(pool->slots[slot], RNG90_POOL_BLOCK_SIZE);
+    pool->borrowed &= ~(1u << slot);
+}
+
+uint8_t rng90_pool_available(rng90_pool_t* pool)
+{
+    return (uint8_t)__builtin_popcount(pool->ready);
+}
+
+void rng90_pool_set_target(rng90_pool_t* pool, uint8_t target)
+{
+    pool->target = target < RNG90_POOL_SLOTS ? target : RNG90_POOL_SLOTS;
+}
+
+void rng90_pool_set_high_reserve(rng90_pool_t* pool, uint8_t blocks)
+{
+    pool->high_reserve = blocks < RNG90_POOL_SLOTS - 1 ? blocks : RNG90_POOL_SLOTS - 1;
+}
+
+void rng90_pool_set_auto_sleep(rng90_pool_t* pool, bool enabled)
+{
+    pool->auto_sleep = enabled;
+}
+
+void rng90_pool_set_monitor(rng90_pool_t* pool, rng90_monitor_t* monitor)
+{
+    pool->monitor = monitor;
+}
+
+bool rng90_pool_is_healthy(rng90_pool_t* pool)
+{
+    return !pool->health_failed;
+}
+
+void rng90_pool_clear_health_failure(rng90_pool_t* pool)
+{
+    pool->health_failed = false;
+    pool->have_last = false;
+    pool->alarm_windows = 0;
+}
+
+bool rng90_pool_take_sleep_request(rng90_pool_t* pool)
+{
+    bool requested = pool->sleep_requested;
+    pool->sleep_requested = false;
+
+    return requested;
+}
+
+void rng90_pool_set_adaptive(rng90_pool_t* pool, bool enabled, uint8_t min_target, uint8_t max_target)
+{
+    if (max_target > RNG90_POOL_SLOTS) max_target = RNG90_POOL_SLOTS;
+    if (min_target > max_target) min_target = max_target;
+
+    pool->adaptive = enabled;
+    pool->min_target = min_target;
+    pool->max_target = max_target;
+    pool->burst_blocks = 0;
+    pool->burst_ewma = (uint16_t)(max_target << 8);
+    pool->interval_ewma_us = 0;
+    pool->next_refill = get_absolute_time();
+
+    if (enabled)
+    {
+        pool->target = max_target;
+    }
+}
+
+uint8_t rng90_pool_get_target(rng90_pool_t* pool)
+{
+    return pool->target;
+}
+
+float rng90_pool_get_hit_ratio(rng90_pool_t* pool)
+{
+    uint32_t total = pool->hits + pool->misses;
+
+    return total ? (float)pool->hits / (float)total : 1.0f;
+}
+
+void rng90_pool_reserve(rng90_pool_t* pool, size_t bytes, absolute_time_t deadline)
+{
+    size_t blocks = (bytes + RNG90_POOL_BLOCK_SIZE - 1) / RNG90_POOL_BLOCK_SIZE;
+
+    pool->reserved = (uint8_t)(blocks < RNG90_POOL_SLOTS - 1 ? blocks : RNG90_POOL_SLOTS - 1);
+    pool->reserve_deadline = deadline;
+}
+
+bool rng90_pool_needs_refill(rng90_pool_t* pool)
+{
+    bool reserving;
+    uint8_t target = effective_target(pool, &reserving);
+
+    return !pool->health_failed && rng90_pool_available(pool) < target && free_slot(pool) >= 0;
+}
+
+uint8_t* rng90_pool_begin_fill(rng90_pool_t* pool)
+{
+    int slot = free_slot(pool);
+    if (slot < 0)
+    {
+        return NULL;
+    }
+
+    // Held as borrowed until filled so the slot is neither handed out nor filled twice.
+    pool->borrowed |= (1u << slot);
+    return pool->slots[slot];
+}
+
+void rng90_pool_end_fill(rng90_pool_t* pool, uint8_t* block, bool success)
+{
+    size_t slot = (size_t)(block - &pool->slots[0][0]) / RNG90_POOL_BLOCK_SIZE;
+    if (slot >= RNG90_POOL_SLOTS || !(pool->borrowed & (1u << slot)))
+    {
+        return;
+    }
+
+    pool->borrowed &= ~(1u << slot);
+    if (success)
+    {
+        accept_block(pool, (uint8_t)slot);
+    }
+    else
+    {
+        rng90_secure_wipe(pool->slots[slot], RNG90_POOL_BLOCK_SIZE);
+    }
+}
+
+bool rng90_pool_service(rng90_pool_t* pool)
+{
+    if (rng90_pool_take_sleep_request(pool))
+    {
+        rng90_sleep(pool->ctx);
+    }
+
+    bool reserving;
+    uint8_t target = effective_target(pool, &reserving);
+
+    uint8_t available = rng90_pool_available(pool);
+    if (available >= target || free_slot(pool) < 0)
+    {
+        if (pool->auto_sleep && !reserving)
+        {
+            rng90_sleep(pool->ctx);
+        }
+        return true;
+    }
+
+    if (pool->adaptive && !reserving && available > pool->high_reserve && !time_reached(pool->next_refill))
+    {
+        return true;
+    }
+
+    // Restoring the high priority reserve always comes first and is never deferred.
+    uint8_t needed = available < pool->high_reserve ? pool->high_reserve - available : 1;
+    uint8_t reserve_target = reservation_target(pool);
+    if (reserving && available < reserve_target)
+    {
+        // Bring the reserved blocks forward if leaving them to later calls may be too late.
+        uint8_t missing = reserve_target - available;
+        int64_t time_needed_us = (int64_t)missing * BLOCK_TIME_MS * 1000;
+        if (!pool->ctx->test_complete)
+        {
+            time_needed_us += (FIRST_BLOCK_TIME_MS - BLOCK_TIME_MS) * 1000;
+        }
+
+        if (absolute_time_diff_us(get_absolute_time(), pool->reserve_deadline) <= time_needed_us &&
+            missing > needed)
+        {
+            needed = missing;
+        }
+    }
+
+    for (uint8_t i = 0; i < needed; ++i)
+    {
+        int slot = free_slot(pool);
+        if (slot < 0)
+        {
+            break;
+        }
+
+        if (!fill_slot(pool, (uint8_t)slot))
+        {
+            return false;
+        }
+    }
+
+    if (pool->adaptive)
+    {
+        adapt(pool);
+    }
+
+    return true;
+}
+
+// Internal function implementations
+
+static int free_slot(rng90_pool_t* pool)
+{
+    uint32_t free = ~(pool->ready | pool->borrowed) & ALL_SLOTS;
+
+    return free ? __builtin_ctz(free) : -1;
+}
+
+static bool fill_slot(rng90_pool_t* pool, uint8_t slot)
+{
+    if (!rng90_random(pool->ctx, pool->slots[slot], RNG90_POOL_BLOCK_SIZE))
+    {
+        rng90_log(pool->ctx, "RNG90 pool: refill of slot %u failed\n", slot);
+        return false;
+    }
+
+    return accept_block(pool, slot);
+}
+
+static bool reservation_active(rng90_pool_t* pool)
+{
+    if (pool->reserved == 0)
+    {
+        return false;
+    }
+
+    if (time_reached(delayed_by_us(pool->reserve_deadline, RNG90_POOL_RESERVE_HOLD_MS * 1000)))
+    {
+        pool->reserved = 0;
+        return false;
+    }
+
+    return true;
+}
+
+static void track_demand(rng90_pool_t* pool, bool hit)
+{
+    if (hit)
+    {
+        ++pool->hits;
+    }
+    else
+    {
+        ++pool->misses;
+    }
+
+    if (!pool->adaptive)
+    {
+        return;
+    }
+
+    absolute_time_t now = get_absolute_time();
+    if (pool->burst_blocks > 0 &&
+        absolute_time_diff_us(pool->last_acquire, now) >= RNG90_POOL_BURST_GAP_MS * 1000)
+    {
+        // The previous burst has ended, fold it into the averages.
+        int32_t burst = (int32_t)(pool->burst_blocks << 8);
+        pool->burst_ewma = (uint16_t)((int32_t)pool->burst_ewma + (burst - (int32_t)pool->burst_ewma) / EWMA_WEIGHT);
+
+        int64_t interval = absolute_time_diff_us(pool->burst_start, now);
+        if (interval > UINT32_MAX) interval = UINT32_MAX;
+        if (pool->interval_ewma_us == 0)
+        {
+            pool->interval_ewma_us = (uint32_t)interval;
+        }
+        else
+        {
+            pool->interval_ewma_us = (uint32_t)((int64_t)pool->interval_ewma_us +
+                (interval - (int64_t)pool->interval_ewma_us) / EWMA_WEIGHT);
+        }
+
+        pool->burst_blocks = 0;
+        adapt(pool);
+    }
+
+    if (pool->burst_blocks == 0)
+    {
+        pool->burst_start = now;
+    }
+    if (pool->burst_blocks < UINT8_MAX)
+    {
+        ++pool->burst_blocks;
+    }
+    pool->last_acquire = now;
+}
+
+/*
+ * Size the pool to hold a typical burst, and spread its refill across the
+ * typical gap between bursts so the device isn't kept busy any more than needed.
+ */
+static void adapt(rng90_pool_t* pool)
+{
+    uint8_t target = (uint8_t)((pool->burst_ewma + 0xFF) >> 8);
+    if (target < pool->min_target) target = pool->min_target;
+    if (target > pool->max_target) target = pool->max_target;
+    pool->target = target;
+
+    uint32_t cadence_us = BLOCK_TIME_MS * 1000;
+    if (target > 0 && pool->interval_ewma_us / target > cadence_us)
+    {
+        // Aim to have the pool refilled by half way to the next expected burst.
+        cadence_us = pool->interval_ewma_us / target / 2;
+        if (cadence_us < BLOCK_TIME_MS * 1000) cadence_us = BLOCK_TIME_MS * 1000;
+    }
+    pool->next_refill = make_timeout_time_us(cadence_us);
+}
+
+static bool has_ready_block(rng90_pool_t* pool, rng90_pool_priority_t priority)
+{
+    // Only high priority requests can take the blocks held back for high priority,
+    // and normal priority requests can't take the reserved blocks either.
+    uint8_t held_back = 0;
+    if (priority == RNG90_POOL_PRIORITY_NORMAL && reservation_active(pool))
+    {
+        held_back = reservation_target(pool);
+    }
+    else if (priority != RNG90_POOL_PRIORITY_HIGH)
+    {
+        held_back = pool->high_reserve;
+    }
+
+    return rng90_pool_available(pool) > held_back;
+}
+
+static void take_block(rng90_pool_t* pool, rng90_pool_priority_t priority, const uint8_t** block)
+{
+    uint8_t slot = (uint8_t)__builtin_ctz(pool->ready);
+    pool->ready &= ~(1u << slot);
+    pool->borrowed |= (1u << slot);
+    *block = pool->slots[slot];
+
+    if (priority == RNG90_POOL_PRIORITY_RESERVED && reservation_active(pool))
+    {
+        --pool->reserved;
+    }
+}
+
+static uint8_t effective_target(rng90_pool_t* pool, bool* reserving)
+{
+    uint8_t target = pool->target > pool->high_reserve ? pool->target : pool->high_reserve;
+
+    *reserving = reservation_active(pool);
+    if (*reserving && reservation_target(pool) > target)
+    {
+        target = reservation_target(pool);
+    }
+
+    return target;
+}
+
+/*
+ * Reserved blocks are held back from normal priority requests on top of the
+ * blocks held back for high priority. One slot is always left over so a
+ * normal priority request can still read a block from the device.
+ */
+static uint8_t reservation_target(rng90_pool_t* pool)
+{
+    unsigned int blocks = (unsigned int)pool->high_reserve + pool->reserved;
+
+    return (uint8_t)(blocks < RNG90_POOL_SLOTS - 1 ? blocks : RNG90_POOL_SLOTS - 1);
+}
+
+static bool accept_block(rng90_pool_t* pool, uint8_t slot)
+{
+    if (!pool->health_failed && health_check(pool, pool->slots[slot]))
+    {
+        pool->ready |= (1u << slot);
+        return true;
+    }
+
+    rng90_secure_wipe(pool->slots[slot], RNG90_POOL_BLOCK_SIZE);
+    return false;
+}
+
+/*
+ * Continuous test against the previous block plus the optional window monitor.
+ * Only an XOR fold of the previous block is kept so its output isn't retained.
+ */
+static bool health_check(rng90_pool_t* pool, const uint8_t* block)
+{
+    uint64_t fold = 0;
+    for (size_t i = 0; i < RNG90_POOL_BLOCK_SIZE; i += sizeof(fold))
+    {
+        uint64_t word;
+        memcpy(&word, &block[i], sizeof(word));
+        fold ^= word;
+    }
+
+    bool repeated = pool->have_last && fold == pool->last_fold;
+    pool->last_fold = fold;
+    pool->have_last = true;
+
+    uint8_t alarms = RNG90_MONITOR_ALARM_NONE;
+    if (pool->monitor)
+    {
+        uint32_t windows = pool->monitor->windows;
+        alarms = rng90_monitor_update(pool->monitor, block);
+        if (pool->monitor->windows != windows)
+        {
+            // Each window has a small false alarm rate, only consecutive alarms latch.
+            pool->alarm_windows = alarms == RNG90_MONITOR_ALARM_NONE ? 0 : pool->alarm_windows + 1;
+        }
+    }
+
+    if (!repeated && alarms == RNG90_MONITOR_ALARM_NONE)
+    {
+        return true;
+    }
+
+    rng90_log(pool->ctx, "RNG90 pool: health test failed, repeated %d alarms 0x%02x\n", repeated, alarms);
+    if (repeated || pool->alarm_windows >= RNG90_POOL_ALARM_WINDOWS)
+    {
+        pool->health_failed = true;
+    }
+
+    // Nothing buffered since the failure started can be trusted.
+    for (uint8_t i = 0; i < RNG90_POOL_SLOTS; i++)
+    {
+        if (pool->ready & (1u << i))
+        {
+            rng90_secure_wipe(pool->slots[i], RNG90_POOL_BLOCK_SIZE);
+        }
+    }
+    pool->ready = 0;
+
+    // A sleep and wake cycle clears the device's own health test state, this may be
+    // running in the async worker so the sleep is left to the next service.
+    pool->sleep_requested = true;
+
+    return false;
+}
@@ -19,7 +19,11 @@
 #include <string.h>
 
 #include "rng90/crc.h"
+#include "rng90/frames.h"
 #include "rng90/rng90.h"
+#include "rng90/wipe.h"
+#include "rng90_hot.h"
+#include "rng90_log.h"
 
 #define RNG_90_I2C_ADDRESS 0x40
 
@@ -27,13 +31,25 @@
 #define WORD_ADDRESS_SLEEP 0x01
 #define WORD_ADDRESS_COMMAND 0x03
 
-#define COMMAND_INFO 0x30
 #define COMMAND_SELFTEST 0x77
 #define COMMAND_RANDOM 0x16
 
+#define STATUS_WAKE 0x11
+
+// Idle period beyond which sleeping uses less energy than staying awake, see rng90_power_down().
+#ifndef RNG90_AWAKE_BREAK_EVEN_MS
+#define RNG90_AWAKE_BREAK_EVEN_MS 150
+#endif
+
+// Power up takes 1.0-1.8 ms, poll for the wake response until well past the maximum.
+#define WAKE_TIMEOUT_US 2500
+#define WAKE_POLL_INTERVAL_US 100
+#define WAKE_MIN_US 1000 // tPU 1.0-1.8 ms
+
 #define RANDOM_BYTES_PER_CALL 32
 
-#define rng90_log(ctx, ...) do { if ((ctx)->logging) printf(__VA_ARGS__); } while (0)
+#define RANDOM_TIME_MS 30 // 20.2-25.3 ms
+#define RANDOM_FIRST_TIME_MS 75 // Includes self-tests: 57-72 ms
 
 // Maximum response size: Random command returns 35 bytes (count + 32 data + 2 CRC)
 #define MAX_RESPONSE_SIZE 35
@@ -44,6 +60,12 @@ static bool load_info(rng90_context_t* ctx);
 static void set_crc(uint8_t* data);
 static void log_message(rng90_context_t* ctx, const char* label, const uint8_t* data, bool is_response);
 static bool ensure_awake(rng90_context_t* ctx);
+static bool read_response(rng90_context_t* ctx, const char* label, uint8_t* response);
+static bool issue_random(rng90_context_t* ctx, bool includes_selftest);
+static void wait_random(rng90_context_t* ctx);
+static void discard_speculation(rng90_context_t* ctx);
+static void wait_until(rng90_context_t* ctx, absolute_time_t until);
+static void publish_state(rng90_context_t* ctx);
 
 void rng90_set_i2c_instance(rng90_context_t* ctx, i2c_inst_t* i2c_inst)
 {
@@ -57,6 +79,18 @@ void rng90_set_i2c_instance(rng90_context_t* ctx, i2c_inst_t* i2c_inst)
     ctx->silicon_rev = 0x00;
     ctx->test_complete = false;
     ctx->logging = false;
+    ctx->speculative = false;
+    ctx->random_pending = false;
+    ctx->random_ready_at = nil_time;
+    ctx->wake_started_at = nil_time;
+    ctx->wake_count = 0;
+    ctx->wake_latency_us = 0;
+    ctx->wake_latency_max_us = 0;
+    ctx->wait_hook = NULL;
+    ctx->wait_hook_data = NULL;
+    ctx->mirror_state = NULL;
+    ctx->mirror_pending = NULL;
+    ctx->mirror_deadline = NULL;
 }
 
 bool rng90_is_initialized(rng90_context_t* ctx)
@@ -74,6 +108,15 @@ void rng90_set_logging(rng90_context_t* ctx, bool enabled)
     ctx->logging = enabled;
 }
 
+void rng90_set_speculative(rng90_context_t* ctx, bool enabled)
+{
+    ctx->speculative = enabled;
+    if (!enabled)
+    {
+        discard_speculation(ctx);
+    }
+}
+
 uint8_t rng90_get_rfu(rng90_context_t* ctx)
 {
     return ctx->rfu;
@@ -94,10 +137,44 @@ uint8_t rng90_get_silicon_rev(rng90_context_t* ctx)
     return ctx->silicon_rev;
 }
 
+uint32_t rng90_get_wake_count(rng90_context_t* ctx)
+{
+    return ctx->wake_count;
+}
+
+uint32_t rng90_get_wake_latency_us(rng90_context_t* ctx)
+{
+    return ctx->wake_latency_us;
+}
+
+uint32_t rng90_get_wake_latency_max_us(rng90_context_t* ctx)
+{
+    return ctx->wake_latency_max_us;
+}
+
+void rng90_set_state_mirror(rng90_context_t* ctx, uint8_t* state, uint8_t* pending, uint32_t* deadline)
+{
+    ctx->mirror_state = state;
+    ctx->mirror_pending = pending;
+    ctx->mirror_deadline = deadline;
+    publish_state(ctx);
+}
+
+void rng90_set_wait_hook(rng90_context_t* ctx, rng90_wait_hook_t hook, void* user_data)
+{
+    ctx->wait_hook = hook;
+    ctx->wait_hook_data = user_data;
+}
+
 /**
  * For initialisation it is possible we all started at the same time,
  * or if just a software reset the RNG90 could have previously been
  * put to sleep so consider both wake and init here.
+ *
+ * The device is put to sleep first so that either way it is woken with the
+ * same checked sequence as an auto-wake. A command left running from before
+ * a reset keeps the device from accepting the sleep, so allow once for the
+ * longest command to finish.
  */
 void rng90_init(rng90_context_t* ctx)
 {
@@ -106,54 +183,27 @@ void rng90_init(rng90_context_t* ctx)
         return;
     }
 
-    int count = 0;
-    uint8_t command[1] = { WORD_ADDRESS_RESET }; // Reset command, by sending to device it wakes it.
-    count = i2c_write_blocking(ctx->i2c_inst, RNG_90_I2C_ADDRESS, command, 1, false);
-
-    if (count < 0)
-    {
-        // Device may be sleepy.
-        sleep_ms(2); // Maximum wake time is 1.8ms
-        count = i2c_write_blocking(ctx->i2c_inst, RNG_90_I2C_ADDRESS, command, 1, false);
-    }
-
-    if (count < 0)
+    bool awake = false;
+    for (int attempt = 0; attempt < 2 && !awake; ++attempt)
     {
-        // Still failed, give up for now.
-        rng90_log(ctx, "RNG90 I2C wake/init error %d\n", count);
-        return;
-    }
-
-    rng90_log(ctx, "RNG90 I2C wake/init wrote %d bytes.\n", count);
-
+        if (attempt > 0)
+        {
+            sleep_ms(RANDOM_FIRST_TIME_MS);
+        }
 
-    // As the last command was a reset we can read the last response from the device,
-    // we probably don't want to try and interpret the conent but may be good to validate
-    // the CRC to confirm integrity of the connection.
+        // NACKed if already asleep, which is just as good.
+        uint8_t command[1] = { WORD_ADDRESS_SLEEP };
+        i2c_write_blocking(ctx->i2c_inst, RNG_90_I2C_ADDRESS, command, sizeof(command), false);
+        ctx->sleeping = true;
+        ctx->test_complete = false;
 
-    // Now read back status to confirm a successful wake.
-    uint8_t response[MAX_RESPONSE_SIZE];
-    count = i2c_read_blocking(ctx->i2c_inst, RNG_90_I2C_ADDRESS, response, 1, true);
-    if (count < 0)
-    {
-        rng90_log(ctx, "RNG90 I2C wake/init read error %d\n", count);
-        return;
+        awake = ensure_awake(ctx);
     }
 
-    uint8_t remaining = response[0] < MAX_RESPONSE_SIZE ? response[0] : MAX_RESPONSE_SIZE - 1;
-    int read_count = i2c_read_blocking(ctx->i2c_inst, RNG_90_I2C_ADDRESS, &response[1],
-        remaining, false);
-    if (read_count < 0)
-    {
-        rng90_log(ctx, "RNG90 I2C wake/init read error %d\n", read_count);
-        return;
-    }
-
-    log_message(ctx, "RNG90 Wake Response:", response, true);
-
-    if (!validate_response(&response[0]))
+    if (!awake)
     {
-        rng90_log(ctx, "RNG90 I2C wake/init response CRC invalid\n");
+        // Still failed, give up for now.
+        rng90_log(ctx, "RNG90 I2C wake/init failed\n");
         return;
     }
 
@@ -161,8 +211,8 @@ void rng90_init(rng90_context_t* ctx)
     //   By reading identification information we further confirm the device is ready for use.
     load_info(ctx);
 
-    ctx->sleeping = false;
     ctx->initialized = true;
+    publish_state(ctx);
 }
 
 void rng90_sleep(rng90_context_t* ctx)
@@ -172,7 +222,9 @@ void rng90_sleep(rng90_context_t* ctx)
         return;
     }
 
-    uint8_t command[1] = { 0x01 }; // Sleep command
+    discard_speculation(ctx);
+
+    uint8_t command[1] = { WORD_ADDRESS_SLEEP };
     int count = i2c_write_blocking(ctx->i2c_inst, RNG_90_I2C_ADDRESS, command, 1, false);
 
     if (count < 0)
@@ -184,20 +236,27 @@ void rng90_sleep(rng90_context_t* ctx)
     rng90_log(ctx, "RNG90 I2C sleep wrote %d bytes.\n", count);
     ctx->sleeping = true;
     ctx->test_complete = false;
+    publish_state(ctx);
 }
 
-// Internal function implementations
-
-static bool validate_response(const uint8_t* data)
+rng90_power_mode_t rng90_power_down(rng90_context_t* ctx, uint32_t expected_idle_ms)
 {
-    uint8_t length = data[0] - 2; // Exclude the CRC bytes.
+    if (ctx->initialized && !ctx->sleeping && expected_idle_ms < RNG90_AWAKE_BREAK_EVEN_MS)
+    {
+        rng90_log(ctx, "RNG90 staying awake for %u ms idle\n", (unsigned)expected_idle_ms);
+        return RNG90_POWER_AWAKE;
+    }
 
-    crc_t crc = rng90_crc16(&data[0], length);
+    rng90_sleep(ctx);
+
+    return ctx->sleeping ? RNG90_POWER_SLEEP : RNG90_POWER_AWAKE;
+}
 
-    uint8_t crc_lsb = crc & 0xFF;
-    uint8_t crc_msb = (crc >> 8) & 0xFF;
+// Internal function implementations
 
-    return (crc_lsb == data[length] && crc_msb == data[length + 1]);
+static bool RNG90_HOT_FUNC(validate_response)(const uint8_t* data)
+{
+    return rng90_crc16_check_frame(data);
 }
 
 static void set_crc(uint8_t* data)
@@ -216,7 +275,7 @@ static void set_crc(uint8_t* data)
 
 static void log_message(rng90_context_t* ctx, const char* label, const uint8_t* data, bool is_response)
 {
-    if (!ctx->logging) return;
+    if (!RNG90_LOGGING || !ctx->logging) return;
 
     uint8_t count = data[0];
 
@@ -273,17 +332,11 @@ static void log_message(rng90_context_t* ctx, const char* label, const uint8_t*
 // is marked as initialized.
 static bool load_info(rng90_context_t* ctx)
 {
-    // Command
-    // Length 7
-    // Info Command
-    // Param 1 0x00
-    // Param 2 0x00 0x00
-    uint8_t info_command[8] = { WORD_ADDRESS_COMMAND, 0x07, COMMAND_INFO, 0x00, 0x00, 0x00, 0x00, 0x00 };
-    set_crc(&info_command[1]);
+    static const uint8_t info_command[RNG90_FRAME_INFO_SIZE] = RNG90_FRAME_INFO;
 
     log_message(ctx, "RNG90 Info Command:", &info_command[1], false);
 
-    int count = i2c_write_blocking(ctx->i2c_inst, RNG_90_I2C_ADDRESS, info_command, 8, false);
+    int count = i2c_write_blocking(ctx->i2c_inst, RNG_90_I2C_ADDRESS, info_command, sizeof(info_command), false);
     if (count < 0)
     {
         rng90_log(ctx, "RNG90 I2C info command write error %d\n", count);
@@ -336,6 +389,113 @@ static bool load_info(rng90_context_t* ctx)
     return true;
 }
 
+/*
+ * Read a complete response into a MAX_RESPONSE_SIZE buffer, the count byte
+ * is read first to find out how much more to read.
+ */
+static bool RNG90_HOT_FUNC(read_response)(rng90_context_t* ctx, const char* label, uint8_t* response)
+{
+    int count = i2c_read_blocking(ctx->i2c_inst, RNG_90_I2C_ADDRESS, response, 1, true);
+    if (count < 0)
+    {
+        rng90_log(ctx, "RNG90 %s read error %d\n", label, count);
+        return false;
+    }
+
+    if (response[0] < 4 || response[0] > MAX_RESPONSE_SIZE)
+    {
+        rng90_log(ctx, "RNG90 %s invalid response count: %u\n", label, (unsigned)response[0]);
+        return false;
+    }
+
+    int read_count = i2c_read_blocking(ctx->i2c_inst, RNG_90_I2C_ADDRESS, &response[1],
+        response[0] - 1, false);
+    if (read_count < 0)
+    {
+        rng90_log(ctx, "RNG90 %s read error %d\n", label, read_count);
+        return false;
+    }
+
+    return true;
+}
+
+// Timing Typical = 20.2 - 25.3, Max = 57.0 - 72.0 on first use.
+static bool RNG90_HOT_FUNC(issue_random)(rng90_context_t* ctx, bool includes_selftest)
+{
+    // Wire: [word_addr=0x03] [count=0x1B] [opcode=0x16] [param1] [param2 LSB] [param2 MSB] [20 data bytes] [CRC-LSB] [CRC-MSB]
+    // The command never changes so is built once with its CRC.
+    static const uint8_t RNG90_HOT_DATA command[RNG90_FRAME_RANDOM_SIZE] = RNG90_FRAME_RANDOM;
+
+    int count = i2c_write_blocking(ctx->i2c_inst, RNG_90_I2C_ADDRESS, command, sizeof(command), false);
+    if (count < 0)
+    {
+        rng90_log(ctx, "RNG90 random write error %d\n", count);
+        ctx->random_pending = false;
+        publish_state(ctx);
+        return false;
+    }
+
+    ctx->random_pending = true;
+    ctx->random_ready_at = make_timeout_time_ms(includes_selftest ? RANDOM_FIRST_TIME_MS : RANDOM_TIME_MS);
+    publish_state(ctx);
+    return true;
+}
+
+/*
+ * Wait for the issued Random command to complete, after which the
+ * response must be read before any other command is issued.
+ */
+static void RNG90_HOT_FUNC(wait_random)(rng90_context_t* ctx)
+{
+    wait_until(ctx, ctx->random_ready_at);
+    ctx->random_pending = false;
+    publish_state(ctx);
+}
+
+/*
+ * Copy the scheduling state into the packed mirror, called wherever the driver
+ * changes any of the fields it covers so the mirror never goes stale.
+ */
+static void RNG90_HOT_FUNC(publish_state)(rng90_context_t* ctx)
+{
+    if (!ctx->mirror_state)
+    {
+        return;
+    }
+
+    uint8_t state = 0;
+    if (ctx->initialized) state |= RNG90_STATE_INITIALIZED;
+    if (ctx->sleeping) state |= RNG90_STATE_SLEEPING;
+    if (ctx->test_complete) state |= RNG90_STATE_TEST_COMPLETE;
+    if (ctx->random_pending) state |= RNG90_STATE_PENDING;
+
+    *ctx->mirror_state = state;
+    *ctx->mirror_pending = ctx->random_pending ? COMMAND_RANDOM : 0x00;
+    *ctx->mirror_deadline = (uint32_t)to_us_since_boot(ctx->random_ready_at);
+}
+
+static void RNG90_HOT_FUNC(wait_until)(rng90_context_t* ctx, absolute_time_t until)
+{
+    if (ctx->wait_hook)
+    {
+        ctx->wait_hook(ctx->wait_hook_data, until);
+    }
+
+    sleep_until(until);
+}
+
+static void discard_speculation(rng90_context_t* ctx)
+{
+    if (!ctx->random_pending)
+    {
+        return;
+    }
+
+    // The device ignores all I/O while busy, the next command replaces the unread result.
+    rng90_log(ctx, "RNG90 discarding speculative random result\n");
+    wait_random(ctx);
+}
+
 static bool ensure_awake(rng90_context_t* ctx)
 {
     if (!ctx->sleeping)
@@ -343,36 +503,77 @@ static bool ensure_awake(rng90_context_t* ctx)
         return true;
     }
 
-    uint8_t command[1] = { WORD_ADDRESS_RESET };
-    int count = i2c_write_blocking(ctx->i2c_inst, RNG_90_I2C_ADDRESS, command, 1, false);
+    rng90_wake_start(ctx);
 
-    if (count < 0)
+    // No point polling before the minimum power up time, leave that window to the hook.
+    if (ctx->wait_hook)
     {
-        sleep_ms(2);
-        count = i2c_write_blocking(ctx->i2c_inst, RNG_90_I2C_ADDRESS, command, 1, false);
+        wait_until(ctx, delayed_by_us(ctx->wake_started_at, WAKE_MIN_US));
     }
 
-    if (count < 0)
+    rng90_wake_status_t status;
+    while ((status = rng90_wake_poll(ctx)) == RNG90_WAKE_PENDING)
     {
-        rng90_log(ctx, "RNG90 auto-wake error %d\n", count);
-        return false;
+        wait_until(ctx, make_timeout_time_us(WAKE_POLL_INTERVAL_US));
     }
 
-    uint8_t response[MAX_RESPONSE_SIZE];
-    count = i2c_read_blocking(ctx->i2c_inst, RNG_90_I2C_ADDRESS, response, 1, true);
+    return status == RNG90_WAKE_DONE;
+}
+
+/*
+ * Wake using the documented sequence, addressing the device is enough to
+ * wake it. The device doesn't ACK until it has powered up (tPU 1.0-1.8 ms)
+ * so rather than waiting for the worst case the wake response is polled for,
+ * the first read to be ACKed returns the complete 4 byte response.
+ */
+void rng90_wake_start(rng90_context_t* ctx)
+{
+    if (!ctx->sleeping)
+    {
+        return;
+    }
+
+    ctx->wake_started_at = get_absolute_time();
+
+    // Wake pulse, a sleeping device NACKs its address so no data is transferred.
+    uint8_t pulse;
+    int count = i2c_read_blocking(ctx->i2c_inst, RNG_90_I2C_ADDRESS, &pulse, 1, false);
+    if (count >= 0)
+    {
+        // Already awake, the pulse consumed the count byte so rewind the output
+        // buffer for the poll to read the whole response.
+        rng90_log(ctx, "RNG90 wake pulse ACKed, resetting address counter\n");
+        uint8_t reset[1] = { WORD_ADDRESS_RESET };
+        i2c_write_blocking(ctx->i2c_inst, RNG_90_I2C_ADDRESS, reset, sizeof(reset), false);
+    }
+}
+
+rng90_wake_status_t rng90_wake_poll(rng90_context_t* ctx)
+{
+    if (!ctx->sleeping)
+    {
+        return RNG90_WAKE_DONE;
+    }
+
+    uint8_t response[4];
+    int count = i2c_read_blocking(ctx->i2c_inst, RNG_90_I2C_ADDRESS, response, sizeof(response), false);
+    int64_t elapsed_us = absolute_time_diff_us(ctx->wake_started_at, get_absolute_time());
+
     if (count < 0)
     {
-        rng90_log(ctx, "RNG90 auto-wake read error %d\n", count);
-        return false;
+        if (elapsed_us < WAKE_TIMEOUT_US)
+        {
+            return RNG90_WAKE_PENDING;
+        }
+
+        rng90_log(ctx, "RNG90 auto-wake error %d\n", count);
+        return RNG90_WAKE_FAILED;
     }
 
-    uint8_t remaining = response[0] < MAX_RESPONSE_SIZE ? response[0] : MAX_RESPONSE_SIZE - 1;
-    int read_count = i2c_read_blocking(ctx->i2c_inst, RNG_90_I2C_ADDRESS, &response[1],
-        remaining, false);
-    if (read_count < 0)
+    if (response[0] != sizeof(response))
     {
-        rng90_log(ctx, "RNG90 auto-wake read error %d\n", read_count);
-        return false;
+        rng90_log(ctx, "RNG90 auto-wake unexpected response count: %u\n", (unsigned)response[0]);
+        return RNG90_WAKE_FAILED;
     }
 
     log_message(ctx, "RNG90 Auto-Wake Response:", response, true);
@@ -380,11 +581,27 @@ static bool ensure_awake(rng90_context_t* ctx)
     if (!validate_response(response))
     {
         rng90_log(ctx, "RNG90 auto-wake response CRC invalid\n");
-        return false;
+        return RNG90_WAKE_FAILED;
+    }
+
+    if (response[1] != STATUS_WAKE)
+    {
+        rng90_log(ctx, "RNG90 auto-wake unexpected status 0x%02X\n", response[1]);
+        return RNG90_WAKE_FAILED;
+    }
+
+    uint32_t latency_us = (uint32_t)elapsed_us;
+    ++ctx->wake_count;
+    ctx->wake_latency_us = latency_us;
+    if (latency_us > ctx->wake_latency_max_us)
+    {
+        ctx->wake_latency_max_us = latency_us;
     }
+    rng90_log(ctx, "RNG90 auto-wake after %lu us\n", (unsigned long)latency_us);
 
     ctx->sleeping = false;
-    return true;
+    publish_state(ctx);
+    return RNG90_WAKE_DONE;
 }
 
 rng90_selftest_result_t rng90_self_test(rng90_context_t* ctx, rng90_selftest_type_t type)
@@ -400,6 +617,8 @@ rng90_selftest_result_t rng90_self_test(rng90_context_t* ctx, rng90_selftest_typ
         return RNG90_SELFTEST_COMM_ERROR;
     }
 
+    discard_speculation(ctx);
+
     uint8_t command[8] = {
         WORD_ADDRESS_COMMAND, 0x07, COMMAND_SELFTEST,
         (uint8_t)type, 0x00, 0x00, 0x00, 0x00
@@ -471,7 +690,7 @@ const char* rng90_selftest_result_str(rng90_selftest_result_t result)
     }
 }
 
-bool rng90_random(rng90_context_t* ctx, uint8_t* buf, size_t len)
+bool RNG90_HOT_FUNC(rng90_random)(rng90_context_t* ctx, uint8_t* buf, size_t len)
 {
     if (!ctx->initialized)
     {
@@ -497,75 +716,72 @@ bool rng90_random(rng90_context_t* ctx, uint8_t* buf, size_t len)
         else
         {
             ctx->test_complete = true;
+            publish_state(ctx);
         }
     }
 
-    // Build the Random command packet
-    // Wire: [word_addr=0x03] [count=0x1B] [opcode=0x16] [param1] [param2 LSB] [param2 MSB] [20 data bytes] [CRC-LSB] [CRC-MSB]
-    // Count = 1(count) + 1(opcode) + 1(param1) + 2(param2) + 20(data) + 2(CRC) = 27 = 0x1B
-    uint8_t command[28] = { WORD_ADDRESS_COMMAND, 0x1B, COMMAND_RANDOM, 0x00, 0x00, 0x00 };
-    // Bytes 6-25 are the 20 data bytes (already zeroed)
-    // Bytes 26-27 will be CRC
-    set_crc(&command[1]);
-
     size_t remaining = len;
     size_t offset = 0;
     size_t iterations = (len + RANDOM_BYTES_PER_CALL - 1) / RANDOM_BYTES_PER_CALL;
 
+    uint8_t response[MAX_RESPONSE_SIZE];
+    bool result = true;
+
     for (size_t i = 0; i < iterations; i++)
     {
-        int count = i2c_write_blocking(ctx->i2c_inst, RNG_90_I2C_ADDRESS, command, 28, false);
-        if (count < 0)
+        // The block may already have been requested while processing the last one,
+        // a failed early request is retried here.
+        if (!ctx->random_pending && !issue_random(ctx, first_call_includes_selftest && i == 0))
         {
-            rng90_log(ctx, "RNG90 random write error %d\n", count);
-            return false;
+            result = false;
+            break;
         }
 
-        if (first_call_includes_selftest && i == 0)
-        {
-            sleep_ms(75); // First call includes self-tests: 57-72 ms
-        }
-        else
-        {
-            sleep_ms(30); // Subsequent calls: 20.2-25.3 ms
-        }
+        wait_random(ctx);
 
-        uint8_t resp_length;
-        count = i2c_read_blocking(ctx->i2c_inst, RNG_90_I2C_ADDRESS, &resp_length, 1, true);
-        if (count < 0)
+        if (!read_response(ctx, "random", response))
         {
-            rng90_log(ctx, "RNG90 random read error %d\n", count);
-            return false;
+            result = false;
+            break;
         }
 
-        uint8_t response[resp_length];
-        response[0] = resp_length;
-        int read_count = i2c_read_blocking(ctx->i2c_inst, RNG_90_I2C_ADDRESS,
-            &response[1], resp_length - 1, false);
-        if (read_count < 0)
+        // Start the device on the next block before processing this one so the CRC
+        // check and copy overlap with the device's execution time. A short response
+        // is an error, no further command is issued for it.
+        if (i + 1 < iterations && response[0] == MAX_RESPONSE_SIZE)
         {
-            rng90_log(ctx, "RNG90 random read error %d\n", read_count);
-            return false;
+            issue_random(ctx, false);
         }
 
-        log_message(ctx, "RNG90 Random Response:", response, true);
-
-        if (!validate_response(response))
+        // Checked here so the flash resident log_message() isn't called per block when disabled.
+        if (RNG90_LOGGING && ctx->logging)
         {
-            rng90_log(ctx, "RNG90 random response CRC invalid\n");
-            return false;
+            log_message(ctx, "RNG90 Random Response:", response, true);
         }
 
         // Check for error response (count == 4 means error)
-        if (resp_length == 4)
+        if (response[0] == 4)
         {
-            rng90_log(ctx, "RNG90 random error response: 0x%02X\n", response[1]);
-            return false;
+            if (!validate_response(response))
+            {
+                rng90_log(ctx, "RNG90 random response CRC invalid\n");
+            }
+            else
+            {
+                rng90_log(ctx, "RNG90 random error response: 0x%02X\n", response[1]);
+            }
+            result = false;
+            break;
         }
 
-        // Copy random bytes to output buffer
+        // Validate and copy random bytes to output buffer in a single pass
         size_t to_copy = remaining < RANDOM_BYTES_PER_CALL ? remaining : RANDOM_BYTES_PER_CALL;
-        memcpy(&buf[offset], &response[1], to_copy);
+        if (!rng90_crc16_check_frame_copy(response, &buf[offset], to_copy))
+        {
+            rng90_log(ctx, "RNG90 random response CRC invalid\n");
+            result = false;
+            break;
+        }
         offset += to_copy;
         remaining -= to_copy;
 
@@ -574,8 +790,139 @@ bool rng90_random(rng90_context_t* ctx, uint8_t* buf, size_t len)
         {
             ctx->test_complete = true;
             first_call_includes_selftest = false;
+            publish_state(ctx);
+        }
+
+        // Speculation only continues from a fully validated call.
+        if (i + 1 == iterations && ctx->speculative)
+        {
+            issue_random(ctx, false);
         }
     }
 
+    // The response held random output, don't leave it behind on the stack.
+    rng90_secure_wipe(response, sizeof(response));
+
+    return result;
+}
+
+bool rng90_random_start(rng90_context_t* ctx)
+{
+    if (!ctx->initialized)
+    {
+        rng90_log(ctx, "RNG90 random_start: not initialized\n");
+        return false;
+    }
+
+    if (ctx->sleeping)
+    {
+        rng90_log(ctx, "RNG90 random_start: device sleeping\n");
+        return false;
+    }
+
+    if (ctx->random_pending)
+    {
+        return true;
+    }
+
+    // Without querying the self-test status assume the first call includes them.
+    return issue_random(ctx, !ctx->test_complete);
+}
+
+absolute_time_t rng90_random_ready_at(rng90_context_t* ctx)
+{
+    return ctx->random_ready_at;
+}
+
+bool rng90_random_finish(rng90_context_t* ctx, uint8_t* buf, size_t len)
+{
+    if (!ctx->random_pending)
+    {
+        rng90_log(ctx, "RNG90 random_finish: no command pending\n");
+        return false;
+    }
+
+    wait_random(ctx);
+
+    uint8_t response[MAX_RESPONSE_SIZE];
+    bool result = read_response(ctx, "random", response);
+
+    if (result)
+    {
+        log_message(ctx, "RNG90 Random Response:", response, true);
+
+        size_t to_copy = len < RANDOM_BYTES_PER_CALL ? len : RANDOM_BYTES_PER_CALL;
+        if (response[0] == 4)
+        {
+            rng90_log(ctx, "RNG90 random error response: 0x%02X\n", response[1]);
+            result = false;
+        }
+        else if (!rng90_crc16_check_frame_copy(response, buf, to_copy))
+        {
+            rng90_log(ctx, "RNG90 random response CRC invalid\n");
+            result = false;
+        }
+        else
+        {
+            ctx->test_complete = true;
+            publish_state(ctx);
+        }
+    }
+
+    rng90_secure_wipe(response, sizeof(response));
+
+    return result;
+}
+
+// Timing Typical = 0.4, Max = 0.6
+bool rng90_read_serial(rng90_context_t* ctx, uint8_t* serial)
+{
+    if (!ctx->initialized)
+    {
+        rng90_log(ctx, "RNG90 read_serial: not initialized\n");
+        return false;
+    }
+
+    if (!ensure_awake(ctx))
+    {
+        return false;
+    }
+
+    discard_speculation(ctx);
+
+    static const uint8_t command[RNG90_FRAME_READ_SERIAL_SIZE] = RNG90_FRAME_READ_SERIAL;
+
+    log_message(ctx, "RNG90 Read Command:", &command[1], false);
+
+    int count = i2c_write_blocking(ctx->i2c_inst, RNG_90_I2C_ADDRESS, command, sizeof(command), false);
+    if (count < 0)
+    {
+        rng90_log(ctx, "RNG90 read_serial write error %d\n", count);
+        return false;
+    }
+
+    sleep_ms(1); // Typical 400us, Max 600us
+
+    uint8_t response[MAX_RESPONSE_SIZE];
+    if (!read_response(ctx, "read_serial", response))
+    {
+        return false;
+    }
+
+    log_message(ctx, "RNG90 Read Response:", response, true);
+
+    // Success returns 16 bytes of data, an error returns a single status byte.
+    if (response[0] != 19)
+    {
+        rng90_log(ctx, "RNG90 read_serial unexpected response count: %u\n", (unsigned)response[0]);
+        return false;
+    }
+
+    if (!rng90_crc16_check_frame_copy(response, serial, RNG90_SERIAL_SIZE))
+    {
+        rng90_log(ctx, "RNG90 read_serial response CRC invalid\n");
+        return false;
+    }
+
     return true;
-}
\ No newline at end of file
+}
@@ -0,0 +1,53 @@
+# Checks the precomputed CRC of each command frame in include/rng90/frames.h
+# when the project is configured, so the frames are verified for C only
+# builds as well as by the static_asserts in rng90.hpp.
+#
+# Can also be run directly: cmake -P rng90_check_frames.cmake
+
+function(rng90_crc16 result)
+    set(remainder 0)
+    foreach(byte IN LISTS ARGN)
+        math(EXPR remainder "${remainder} ^ ${byte}")
+        foreach(bit RANGE 7)
+            math(EXPR low "${remainder} & 1")
+            math(EXPR remainder "${remainder} >> 1")
+            if(low)
+                math(EXPR remainder "${remainder} ^ 0xA001")
+            endif()
+        endforeach()
+    endforeach()
+
+    # Reflect the final remainder.
+    set(reflection 0)
+    foreach(bit RANGE 15)
+        math(EXPR reflection "(${reflection} << 1) | ((${remainder} >> ${bit}) & 1)")
+    endforeach()
+
+    set(${result} ${reflection} PARENT_SCOPE)
+endfunction()
+
+file(READ ${CMAKE_CURRENT_LIST_DIR}/include/rng90/frames.h frames)
+
+foreach(name INFO RANDOM READ_SERIAL)
+    if(NOT frames MATCHES "#define RNG90_FRAME_${name} {([^}]*)}")
+        message(FATAL_ERROR "RNG90_FRAME_${name} not found in rng90/frames.h")
+    endif()
+
+    string(REGEX MATCHALL "0x[0-9A-Fa-f][0-9A-Fa-f]" bytes "${CMAKE_MATCH_1}")
+    list(LENGTH bytes length)
+
+    # The CRC covers the count through the data, it follows low byte first.
+    math(EXPR last "${length} - 3")
+    math(EXPR crc_low "${length} - 2")
+    math(EXPR crc_high "${length} - 1")
+    list(SUBLIST bytes 1 ${last} covered)
+    list(GET bytes ${crc_low} low)
+    list(GET bytes ${crc_high} high)
+
+    rng90_crc16(crc ${covered})
+    math(EXPR expected "${low} | (${high} << 8)")
+    if(NOT crc EQUAL expected)
+        math(EXPR crc "${crc}" OUTPUT_FORMAT HEXADECIMAL)
+        message(FATAL_ERROR "RNG90_FRAME_${name} in rng90/frames.h has the wrong CRC, expected ${crc}")
+    endif()
+endforeach()
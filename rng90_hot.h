@@ -0,0 +1,38 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RNG90_HOT_H
+#define RNG90_HOT_H
+
+/*
+ * When built with RNG90_HOT_IN_RAM the functions and tables on the per
+ * block path are placed in SRAM so they never stall on an XIP cache miss.
+ */
+#ifndef RNG90_HOT_IN_RAM
+#define RNG90_HOT_IN_RAM 0
+#endif
+
+#if RNG90_HOT_IN_RAM
+#include "pico/platform.h"
+
+#define RNG90_HOT_FUNC(name) __not_in_flash_func(name)
+#define RNG90_HOT_DATA __not_in_flash("rng90")
+#else
+#define RNG90_HOT_FUNC(name) name
+#define RNG90_HOT_DATA
+#endif
+
+#endif // RNG90_HOT_H
@@ -0,0 +1,34 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RNG90_LOG_H
+#define RNG90_LOG_H
+
+#include <stdio.h>
+
+// Set to 0 to compile diagnostic logging out of the driver entirely.
+#ifndef RNG90_LOGGING
+#define RNG90_LOGGING 1
+#endif
+
+#if RNG90_LOGGING
+#define rng90_log(ctx, ...) do { if ((ctx)->logging) printf(__VA_ARGS__); } while (0)
+#else
+// Arguments are still type checked and consumed, the call is discarded as dead code.
+#define rng90_log(ctx, ...) do { (void)(ctx); if (0) printf(__VA_ARGS__); } while (0)
+#endif
+
+#endif // RNG90_LOG_H
@@ -0,0 +1,39 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "mbedtls/entropy.h"
+
+#include "rng90/mbedtls.h"
+
+int rng90_mbedtls_poll_strong(void* data, unsigned char* output, size_t len, size_t* olen)
+{
+    if (!rng90_entropy_is_healthy((rng90_entropy_t*)data))
+    {
+        *olen = 0;
+        return MBEDTLS_ERR_ENTROPY_SOURCE_FAILED;
+    }
+
+    *olen = rng90_entropy_read((rng90_entropy_t*)data, output, len, RNG90_ENTROPY_STRONG);
+
+    return 0;
+}
+
+int rng90_mbedtls_poll_weak(void* data, unsigned char* output, size_t len, size_t* olen)
+{
+    *olen = rng90_entropy_read((rng90_entropy_t*)data, output, len, RNG90_ENTROPY_WEAK);
+
+    return 0;
+}
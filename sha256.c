@@ -0,0 +1,161 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+
+#include "rng90/sha256.h"
+#include "rng90/wipe.h"
+
+#define ROTR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+static const uint32_t round_constants[64] = {
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+static const uint32_t initial_state[8] = {
+    0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19
+};
+
+/*
+ * The message schedule is kept as a 16 word circular buffer and extended as
+ * the rounds progress, this keeps the stack use of a compression at 64 bytes
+ * for the schedule rather than 256 bytes for a fully expanded schedule.
+ */
+static void compress(uint32_t* state, const uint8_t* block)
+{
+    uint32_t w[16];
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+    for (uint8_t i = 0; i < 64; ++i)
+    {
+        uint32_t wi;
+        if (i < 16)
+        {
+            wi = ((uint32_t)block[i * 4] << 24) | ((uint32_t)block[i * 4 + 1] << 16) |
+                 ((uint32_t)block[i * 4 + 2] << 8) | (uint32_t)block[i * 4 + 3];
+        }
+        else
+        {
+            uint32_t w15 = w[(i - 15) & 0x0F];
+            uint32_t w2 = w[(i - 2) & 0x0F];
+            uint32_t s0 = ROTR(w15, 7) ^ ROTR(w15, 18) ^ (w15 >> 3);
+            uint32_t s1 = ROTR(w2, 17) ^ ROTR(w2, 19) ^ (w2 >> 10);
+            wi = w[i & 0x0F] + s0 + w[(i - 7) & 0x0F] + s1;
+        }
+        w[i & 0x0F] = wi;
+
+        uint32_t t1 = h + (ROTR(e, 6) ^ ROTR(e, 11) ^ ROTR(e, 25)) + ((e & f) ^ (~e & g)) + round_constants[i] + wi;
+        uint32_t t2 = (ROTR(a, 2) ^ ROTR(a, 13) ^ ROTR(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+
+        h = g;
+        g = f;
+        f = e;
+        e = d + t1;
+        d = c;
+        c = b;
+        b = a;
+        a = t1 + t2;
+    }
+
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+
+    rng90_secure_wipe(w, sizeof(w));
+}
+
+void rng90_sha256_init(rng90_sha256_context_t* ctx)
+{
+    memcpy(ctx->state, initial_state, sizeof(initial_state));
+    ctx->length = 0;
+    ctx->block_len = 0;
+}
+
+void rng90_sha256_update(rng90_sha256_context_t* ctx, const uint8_t* data, size_t length)
+{
+    ctx->length += length;
+
+    // Top up any partial block first.
+    if (ctx->block_len > 0)
+    {
+        size_t to_copy = RNG90_SHA256_BLOCK_SIZE - ctx->block_len;
+        if (to_copy > length) to_copy = length;
+
+        memcpy(&ctx->block[ctx->block_len], data, to_copy);
+        ctx->block_len += to_copy;
+        data += to_copy;
+        length -= to_copy;
+
+        if (ctx->block_len < RNG90_SHA256_BLOCK_SIZE)
+        {
+            return;
+        }
+
+        compress(ctx->state, ctx->block);
+        ctx->block_len = 0;
+    }
+
+    // Whole blocks can be compressed in place.
+    while (length >= RNG90_SHA256_BLOCK_SIZE)
+    {
+        compress(ctx->state, data);
+        data += RNG90_SHA256_BLOCK_SIZE;
+        length -= RNG90_SHA256_BLOCK_SIZE;
+    }
+
+    if (length > 0)
+    {
+        memcpy(ctx->block, data, length);
+        ctx->block_len = length;
+    }
+}
+
+void rng90_sha256_final(rng90_sha256_context_t* ctx, uint8_t* digest)
+{
+    uint64_t bit_length = ctx->length * 8;
+
+    ctx->block[ctx->block_len++] = 0x80;
+    if (ctx->block_len > RNG90_SHA256_BLOCK_SIZE - 8)
+    {
+        memset(&ctx->block[ctx->block_len], 0x00, RNG90_SHA256_BLOCK_SIZE - ctx->block_len);
+        compress(ctx->state, ctx->block);
+        ctx->block_len = 0;
+    }
+    memset(&ctx->block[ctx->block_len], 0x00, RNG90_SHA256_BLOCK_SIZE - 8 - ctx->block_len);
+
+    for (uint8_t i = 0; i < 8; ++i)
+    {
+        ctx->block[RNG90_SHA256_BLOCK_SIZE - 1 - i] = (uint8_t)(bit_length >> (i * 8));
+    }
+    compress(ctx->state, ctx->block);
+
+    for (uint8_t i = 0; i < 8; ++i)
+    {
+        digest[i * 4] = (uint8_t)(ctx->state[i] >> 24);
+        digest[i * 4 + 1] = (uint8_t)(ctx->state[i] >> 16);
+        digest[i * 4 + 2] = (uint8_t)(ctx->state[i] >> 8);
+        digest[i * 4 + 3] = (uint8_t)ctx->state[i];
+    }
+
+    rng90_secure_wipe(ctx, sizeof(*ctx));
+}
@@ -0,0 +1,68 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <string.h>
+
+#include "rng90/table.h"
+
+void rng90_table_init(rng90_table_t* table)
+{
+    memset(table, 0x00, sizeof(*table));
+}
+
+int rng90_table_add(rng90_table_t* table, i2c_inst_t* i2c_inst)
+{
+    if (table->count >= RNG90_TABLE_SIZE)
+    {
+        return -1;
+    }
+
+    uint8_t index = table->count++;
+    rng90_context_t* ctx = &table->contexts[index];
+    rng90_set_i2c_instance(ctx, i2c_inst);
+    rng90_set_state_mirror(ctx, &table->state[index], &table->pending[index], &table->deadline[index]);
+
+    return index;
+}
+
+rng90_context_t* rng90_table_context(rng90_table_t* table, uint8_t index)
+{
+    return &table->contexts[index];
+}
+
+int rng90_table_next_due(rng90_table_t* table, uint32_t now)
+{
+    int next = -1;
+    int32_t most_overdue = -1;
+
+    for (uint8_t index = 0; index < table->count; ++index)
+    {
+        if (!(table->state[index] & RNG90_STATE_PENDING))
+        {
+            continue;
+        }
+
+        // Wrap safe comparison of the 32 bit microsecond timer.
+        int32_t overdue = (int32_t)(now - table->deadline[index]);
+        if (overdue > most_overdue)
+        {
+            most_overdue = overdue;
+            next = index;
+        }
+    }
+
+    return next;
+}
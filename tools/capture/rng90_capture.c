@@ -0,0 +1,219 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Host capture tool, reads a capture stream from a USB CDC device such as
+ * /dev/ttyACM0 (or any file, - for stdin) into a preallocated memory-mapped
+ * capture file.
+ *
+ *   rng90_capture <input> <output> <records>
+ *
+ * The output file is sized for the header and all records up front and the
+ * stream is read directly into the mapping. Each record's CRC and sequence
+ * number are checked as it arrives, a record whose CRC doesn't match is kept
+ * with RNG90_CAPTURE_STATUS_CORRUPT so offsets stay fixed. If the stream ends
+ * early the file is truncated to the records received.
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "rng90/capture_format.h"
+#include "rng90/crc.h"
+
+// Internal Function Definitions
+static int open_input(const char* path);
+static bool read_fully(int fd, void* buf, size_t size);
+static bool record_crc_valid(const rng90_capture_record_t* record);
+
+int main(int argc, char** argv)
+{
+    if (argc != 4)
+    {
+        fprintf(stderr, "usage: %s <input> <output> <records>\n", argv[0]);
+        return 2;
+    }
+
+    char* end;
+    unsigned long long count = strtoull(argv[3], &end, 10);
+    if (*end != '\0' || count == 0)
+    {
+        fprintf(stderr, "invalid record count: %s\n", argv[3]);
+        return 2;
+    }
+
+    int in = open_input(argv[1]);
+    if (in < 0)
+    {
+        fprintf(stderr, "%s: %s\n", argv[1], strerror(errno));
+        return 1;
+    }
+
+    rng90_capture_header_t header;
+    if (!read_fully(in, &header, sizeof(header)))
+    {
+        fprintf(stderr, "stream ended before the capture header\n");
+        return 1;
+    }
+
+    if (memcmp(header.magic, RNG90_CAPTURE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != RNG90_CAPTURE_VERSION || header.record_size != sizeof(rng90_capture_record_t))
+    {
+        fprintf(stderr, "not a version %d RNG90 capture stream\n", RNG90_CAPTURE_VERSION);
+        return 1;
+    }
+
+    size_t size = sizeof(header) + (size_t)count * sizeof(rng90_capture_record_t);
+    int out = open(argv[2], O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (out < 0 || ftruncate(out, (off_t)size) != 0)
+    {
+        fprintf(stderr, "%s: %s\n", argv[2], strerror(errno));
+        return 1;
+    }
+
+    // Reserve the blocks now so a long capture can't fail part way on a full disk.
+    int err = posix_fallocate(out, 0, (off_t)size);
+    if (err != 0 && err != EOPNOTSUPP && err != EINVAL)
+    {
+        fprintf(stderr, "%s: %s\n", argv[2], strerror(err));
+        return 1;
+    }
+
+    uint8_t* map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, out, 0);
+    if (map == MAP_FAILED)
+    {
+        fprintf(stderr, "%s: %s\n", argv[2], strerror(errno));
+        return 1;
+    }
+
+    memcpy(map, &header, sizeof(header));
+    rng90_capture_record_t* records = (rng90_capture_record_t*)(map + sizeof(header));
+
+    unsigned long long received = 0;
+    unsigned long long corrupt = 0;
+    unsigned long long failed = 0;
+    unsigned long long gaps = 0;
+    for (; received < count; ++received)
+    {
+        rng90_capture_record_t* record = &records[received];
+        if (!read_fully(in, record, sizeof(*record)))
+        {
+            break;
+        }
+
+        if (!record_crc_valid(record))
+        {
+            record->status = RNG90_CAPTURE_STATUS_CORRUPT;
+            ++corrupt;
+        }
+        else if (record->status != RNG90_CAPTURE_STATUS_OK)
+        {
+            ++failed;
+        }
+
+        if (received > 0 && record->sequence != records[received - 1].sequence + 1)
+        {
+            ++gaps;
+        }
+    }
+
+    msync(map, size, MS_SYNC);
+    munmap(map, size);
+
+    if (received < count && ftruncate(out, (off_t)(sizeof(header) + received * sizeof(rng90_capture_record_t))) != 0)
+    {
+        fprintf(stderr, "%s: %s\n", argv[2], strerror(errno));
+    }
+    close(out);
+    close(in);
+
+    printf("serial ");
+    for (int i = 0; i < RNG90_CAPTURE_SERIAL_SIZE; i++)
+    {
+        printf("%02X", header.serial[i]);
+    }
+    printf(": %llu records, %llu failed, %llu corrupt, %llu sequence gaps\n", received, failed, corrupt, gaps);
+
+    return received == count ? 0 : 1;
+}
+
+// Internal function implementations
+
+static int open_input(const char* path)
+{
+    if (strcmp(path, "-") == 0)
+    {
+        return STDIN_FILENO;
+    }
+
+    int fd = open(path, O_RDONLY | O_NOCTTY);
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    // A CDC ACM device must be switched to raw mode or the stream is mangled.
+    struct termios tio;
+    if (isatty(fd) && tcgetattr(fd, &tio) == 0)
+    {
+        cfmakeraw(&tio);
+        tcsetattr(fd, TCSANOW, &tio);
+    }
+
+    return fd;
+}
+
+static bool read_fully(int fd, void* buf, size_t size)
+{
+    uint8_t* bytes = (uint8_t*)buf;
+    while (size > 0)
+    {
+        ssize_t n = read(fd, bytes, size);
+        if (n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (n <= 0)
+        {
+            return false;
+        }
+        bytes += n;
+        size -= (size_t)n;
+    }
+
+    return true;
+}
+
+static bool record_crc_valid(const rng90_capture_record_t* record)
+{
+    rng90_crc16_context_t crc;
+    rng90_crc16_init(&crc);
+    rng90_crc16_update(&crc, (const uint8_t*)record, offsetof(rng90_capture_record_t, record_crc));
+    rng90_crc16_update(&crc, record->data, RNG90_CAPTURE_DATA_SIZE);
+
+    return rng90_crc16_final(&crc) == record->record_crc;
+}
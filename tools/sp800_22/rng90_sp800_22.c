@@ -0,0 +1,747 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Host harness for lot acceptance, runs a subset of the NIST SP 800-22
+ * statistical test suite over RNG90 output.
+ *
+ *   rng90_sp800_22 [-n bits] [-j threads] file...
+ *
+ * Each file is either a capture written by rng90_capture, whose records are
+ * grouped by the device serial they carry, or raw binary output which is
+ * treated as a device of its own. Each device's output is split into
+ * sequences of n bits (1,000,000 by default, a multiple of 64) and the
+ * sequences are shared out between one worker thread per core.
+ *
+ * For each device and test the proportion of sequences passing at
+ * alpha = 0.01 and the uniformity of the p-values over ten bins are
+ * reported as described in SP 800-22 section 4.2. The exit status is
+ * non-zero if any device falls outside either acceptance range.
+ */
+
+#define _DEFAULT_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "rng90/capture_format.h"
+
+#define ALPHA 0.01
+#define UNIFORMITY_ALPHA 0.0001
+#define UNIFORMITY_MIN_SEQUENCES 55
+#define BLOCK_FREQUENCY_M 128
+#define APPROXIMATE_ENTROPY_M 10
+#define MAX_DEVICES 64
+
+typedef enum {
+    TEST_FREQUENCY,
+    TEST_BLOCK_FREQUENCY,
+    TEST_RUNS,
+    TEST_LONGEST_RUN,
+    TEST_CUSUM_FORWARD,
+    TEST_CUSUM_REVERSE,
+    TEST_APPROXIMATE_ENTROPY,
+    TEST_COUNT
+} test_t;
+
+static const char* const test_names[TEST_COUNT] = {
+    "frequency",
+    "block frequency",
+    "runs",
+    "longest run",
+    "cusum forward",
+    "cusum reverse",
+    "approximate entropy"
+};
+
+struct device {
+    char name[64];
+    uint8_t serial[RNG90_CAPTURE_SERIAL_SIZE];
+    bool from_capture;
+    // Raw files are used in place, capture data is copied out of the records.
+    const uint8_t* data;
+    uint8_t* owned;
+    size_t size;
+    size_t capacity;
+    size_t skipped;
+};
+
+typedef struct device device_t;
+
+struct job {
+    const uint8_t* bytes;
+    // NAN where a test's prerequisite wasn't met.
+    double p[TEST_COUNT];
+};
+
+typedef struct job job_t;
+
+struct harness {
+    job_t* jobs;
+    size_t job_count;
+    atomic_size_t next;
+    size_t bits;
+};
+
+typedef struct harness harness_t;
+
+static device_t devices[MAX_DEVICES];
+static size_t device_count;
+
+// Internal Function Definitions
+static bool load_file(const char* path);
+static device_t* find_capture_device(const uint8_t* serial);
+static bool append(device_t* dev, const uint8_t* data, size_t size);
+static void* worker(void* arg);
+static void run_tests(job_t* job, uint64_t* words, size_t bits);
+static double frequency(const uint64_t* words, size_t bits, size_t* ones);
+static double block_frequency(const uint64_t* words, size_t bits);
+static double runs(const uint64_t* words, size_t bits, size_t ones);
+static double longest_run(const uint64_t* words, size_t bits);
+static void cumulative_sums(const uint64_t* words, size_t bits, double* forward, double* reverse);
+static double cusum_p(long n, long z);
+static double approximate_entropy(const uint64_t* words, size_t bits);
+static bool report(const device_t* dev, const job_t* jobs, size_t count, size_t bits);
+static double igamc(double a, double x);
+static double normal(double x);
+
+static inline unsigned get_bit(const uint64_t* words, size_t i)
+{
+    return (unsigned)(words[i >> 6] >> (63 - (i & 63))) & 1;
+}
+
+int main(int argc, char** argv)
+{
+    size_t bits = 1000000;
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+
+    int opt;
+    while ((opt = getopt(argc, argv, "n:j:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'n':
+            bits = strtoul(optarg, NULL, 10);
+            break;
+        case 'j':
+            threads = strtol(optarg, NULL, 10);
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-n bits] [-j threads] file...\n", argv[0]);
+            return 2;
+        }
+    }
+
+    // The longest run test needs 6272 bits, approximate entropy needs m < log2(n) - 5.
+    if (bits < 65536 || bits % 64 != 0 || threads < 1 || optind >= argc)
+    {
+        fprintf(stderr, "usage: %s [-n bits] [-j threads] file...\n", argv[0]);
+        fprintf(stderr, "bits must be a multiple of 64 and at least 65536\n");
+        return 2;
+    }
+
+    for (int i = optind; i < argc; i++)
+    {
+        if (!load_file(argv[i]))
+        {
+            return 1;
+        }
+    }
+
+    harness_t harness = { .bits = bits };
+    size_t bytes = bits / 8;
+    for (size_t d = 0; d < device_count; d++)
+    {
+        harness.job_count += devices[d].size / bytes;
+    }
+
+    if (harness.job_count == 0)
+    {
+        fprintf(stderr, "not enough data for a single %zu bit sequence\n", bits);
+        return 1;
+    }
+
+    harness.jobs = calloc(harness.job_count, sizeof(job_t));
+    if (harness.jobs == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    size_t index = 0;
+    for (size_t d = 0; d < device_count; d++)
+    {
+        for (size_t offset = 0; offset + bytes <= devices[d].size; offset += bytes)
+        {
+            harness.jobs[index++].bytes = devices[d].data + offset;
+        }
+    }
+
+    if ((size_t)threads > harness.job_count)
+    {
+        threads = (long)harness.job_count;
+    }
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    pthread_t* pool = calloc((size_t)threads, sizeof(pthread_t));
+    for (long t = 0; t < threads; t++)
+    {
+        if (pthread_create(&pool[t], NULL, worker, &harness) != 0)
+        {
+            fprintf(stderr, "failed to start worker %ld\n", t);
+            return 1;
+        }
+    }
+    for (long t = 0; t < threads; t++)
+    {
+        pthread_join(pool[t], NULL);
+    }
+    free(pool);
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double elapsed = (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) / 1e9;
+    printf("%zu sequences of %zu bits on %ld threads in %.2f s\n\n", harness.job_count, bits, threads, elapsed);
+
+    bool passed = true;
+    const job_t* jobs = harness.jobs;
+    for (size_t d = 0; d < device_count; d++)
+    {
+        size_t count = devices[d].size / bytes;
+        passed &= report(&devices[d], jobs, count, bits);
+        jobs += count;
+    }
+
+    return passed ? 0 : 1;
+}
+
+// Internal function implementations
+
+static bool load_file(const char* path)
+{
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0)
+    {
+        fprintf(stderr, "%s: %s\n", path, strerror(errno));
+        return false;
+    }
+
+    if (st.st_size == 0)
+    {
+        close(fd);
+        return true;
+    }
+
+    const uint8_t* map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        fprintf(stderr, "%s: %s\n", path, strerror(errno));
+        return false;
+    }
+
+    size_t size = (size_t)st.st_size;
+    const rng90_capture_header_t* header = (const rng90_capture_header_t*)map;
+    bool capture = size >= sizeof(*header) && memcmp(header->magic, RNG90_CAPTURE_MAGIC, sizeof(header->magic)) == 0;
+
+    if (!capture)
+    {
+        if (device_count == MAX_DEVICES)
+        {
+            fprintf(stderr, "%s: too many devices\n", path);
+            return false;
+        }
+
+        device_t* dev = &devices[device_count++];
+        snprintf(dev->name, sizeof(dev->name), "%s", path);
+        dev->data = map;
+        dev->size = size;
+        madvise((void*)map, size, MADV_SEQUENTIAL);
+        return true;
+    }
+
+    if (header->version != RNG90_CAPTURE_VERSION || header->record_size != sizeof(rng90_capture_record_t))
+    {
+        fprintf(stderr, "%s: unsupported capture version %u\n", path, header->version);
+        return false;
+    }
+
+    const rng90_capture_record_t* records = (const rng90_capture_record_t*)(map + sizeof(*header));
+    size_t count = (size - sizeof(*header)) / sizeof(rng90_capture_record_t);
+    for (size_t i = 0; i < count; i++)
+    {
+        device_t* dev = find_capture_device(records[i].serial);
+        if (dev == NULL)
+        {
+            fprintf(stderr, "%s: too many devices\n", path);
+            return false;
+        }
+
+        // Failed and corrupt records carry no device output.
+        if (records[i].status != RNG90_CAPTURE_STATUS_OK)
+        {
+            ++dev->skipped;
+            continue;
+        }
+
+        if (!append(dev, records[i].data, RNG90_CAPTURE_DATA_SIZE))
+        {
+            fprintf(stderr, "out of memory\n");
+            return false;
+        }
+    }
+
+    munmap((void*)map, size);
+    return true;
+}
+
+static device_t* find_capture_device(const uint8_t* serial)
+{
+    for (size_t d = 0; d < device_count; d++)
+    {
+        if (devices[d].from_capture && memcmp(devices[d].serial, serial, RNG90_CAPTURE_SERIAL_SIZE) == 0)
+        {
+            return &devices[d];
+        }
+    }
+
+    if (device_count == MAX_DEVICES)
+    {
+        return NULL;
+    }
+
+    device_t* dev = &devices[device_count++];
+    dev->from_capture = true;
+    memcpy(dev->serial, serial, RNG90_CAPTURE_SERIAL_SIZE);
+    for (int i = 0; i < RNG90_CAPTURE_SERIAL_SIZE; i++)
+    {
+        snprintf(dev->name + 2 * i, sizeof(dev->name) - 2 * i, "%02X", serial[i]);
+    }
+
+    return dev;
+}
+
+static bool append(device_t* dev, const uint8_t* data, size_t size)
+{
+    if (dev->size + size > dev->capacity)
+    {
+        size_t capacity = dev->capacity ? dev->capacity * 2 : 1 << 20;
+        uint8_t* owned = realloc(dev->owned, capacity);
+        if (owned == NULL)
+        {
+            return false;
+        }
+        dev->owned = owned;
+        dev->data = owned;
+        dev->capacity = capacity;
+    }
+
+    memcpy(dev->owned + dev->size, data, size);
+    dev->size += size;
+    return true;
+}
+
+static void* worker(void* arg)
+{
+    harness_t* harness = (harness_t*)arg;
+    uint64_t* words = malloc(harness->bits / 8);
+    if (words == NULL)
+    {
+        return NULL;
+    }
+
+    for (;;)
+    {
+        size_t index = atomic_fetch_add(&harness->next, 1);
+        if (index >= harness->job_count)
+        {
+            break;
+        }
+
+        run_tests(&harness->jobs[index], words, harness->bits);
+    }
+
+    free(words);
+    return NULL;
+}
+
+static void run_tests(job_t* job, uint64_t* words, size_t bits)
+{
+    // Bits are taken most significant first from each byte, packed so bit 63 of a word comes first.
+    for (size_t w = 0; w < bits / 64; w++)
+    {
+        const uint8_t* b = job->bytes + w * 8;
+        words[w] = (uint64_t)b[0] << 56 | (uint64_t)b[1] << 48 | (uint64_t)b[2] << 40 | (uint64_t)b[3] << 32 |
+                   (uint64_t)b[4] << 24 | (uint64_t)b[5] << 16 | (uint64_t)b[6] << 8 | (uint64_t)b[7];
+    }
+
+    size_t ones;
+    job->p[TEST_FREQUENCY] = frequency(words, bits, &ones);
+    job->p[TEST_BLOCK_FREQUENCY] = block_frequency(words, bits);
+    job->p[TEST_RUNS] = runs(words, bits, ones);
+    job->p[TEST_LONGEST_RUN] = longest_run(words, bits);
+    cumulative_sums(words, bits, &job->p[TEST_CUSUM_FORWARD], &job->p[TEST_CUSUM_REVERSE]);
+    job->p[TEST_APPROXIMATE_ENTROPY] = approximate_entropy(words, bits);
+}
+
+// Section 2.1, frequency (monobit) test.
+static double frequency(const uint64_t* words, size_t bits, size_t* ones)
+{
+    size_t count = 0;
+    for (size_t w = 0; w < bits / 64; w++)
+    {
+        count += (size_t)__builtin_popcountll(words[w]);
+    }
+
+    *ones = count;
+    double s_obs = fabs(2.0 * (double)count - (double)bits) / sqrt((double)bits);
+    return erfc(s_obs / sqrt(2.0));
+}
+
+// Section 2.2, frequency test within a block.
+static double block_frequency(const uint64_t* words, size_t bits)
+{
+    size_t blocks = bits / BLOCK_FREQUENCY_M;
+    double chi_square = 0.0;
+    for (size_t block = 0; block < blocks; block++)
+    {
+        const uint64_t* w = &words[block * (BLOCK_FREQUENCY_M / 64)];
+        int ones = __builtin_popcountll(w[0]) + __builtin_popcountll(w[1]);
+        double pi = (double)ones / BLOCK_FREQUENCY_M - 0.5;
+        chi_square += pi * pi;
+    }
+
+    chi_square *= 4.0 * BLOCK_FREQUENCY_M;
+    return igamc((double)blocks / 2.0, chi_square / 2.0);
+}
+
+/*
+ * Section 2.3, runs test. Only applicable when the frequency test's
+ * proportion of ones is close enough to a half, otherwise NAN is returned
+ * so the sequence is counted once, against the frequency test.
+ */
+static double runs(const uint64_t* words, size_t bits, size_t ones)
+{
+    double pi = (double)ones / (double)bits;
+    if (fabs(pi - 0.5) >= 2.0 / sqrt((double)bits))
+    {
+        return NAN;
+    }
+
+    // The low bit of w ^ (w << 1) compares against the previous word's last bit instead of zero.
+    size_t transitions = 0;
+    for (size_t w = 0; w < bits / 64; w++)
+    {
+        uint64_t x = words[w] ^ (words[w] << 1);
+        transitions += (size_t)__builtin_popcountll(x & ~(uint64_t)1);
+        if (w > 0)
+        {
+            transitions += (unsigned)(words[w] >> 63) != (unsigned)(words[w - 1] & 1);
+        }
+    }
+
+    double v_obs = (double)transitions + 1.0;
+    double n = (double)bits;
+    return erfc(fabs(v_obs - 2.0 * n * pi * (1.0 - pi)) / (2.0 * sqrt(2.0 * n) * pi * (1.0 - pi)));
+}
+
+// Section 2.4, test for the longest run of ones in a block.
+static double longest_run(const uint64_t* words, size_t bits)
+{
+    static const double pi_small[] = { 0.1174, 0.2430, 0.2493, 0.1752, 0.1027, 0.1124 };
+    static const double pi_large[] = { 0.0882, 0.2092, 0.2483, 0.1933, 0.1208, 0.0675, 0.0727 };
+
+    bool large = bits >= 750000;
+    size_t m = large ? 10000 : 128;
+    unsigned k = large ? 6 : 5;
+    unsigned shortest = large ? 10 : 4;
+    const double* pi = large ? pi_large : pi_small;
+
+    size_t v[7] = { 0 };
+    size_t blocks = bits / m;
+    for (size_t block = 0; block < blocks; block++)
+    {
+        unsigned run = 0;
+        unsigned longest = 0;
+        for (size_t i = block * m; i < (block + 1) * m; i++)
+        {
+            run = get_bit(words, i) ? run + 1 : 0;
+            if (run > longest)
+            {
+                longest = run;
+            }
+        }
+
+        if (longest < shortest)
+        {
+            longest = shortest;
+        }
+        else if (longest > shortest + k)
+        {
+            longest = shortest + k;
+        }
+        ++v[longest - shortest];
+    }
+
+    double chi_square = 0.0;
+    for (unsigned i = 0; i <= k; i++)
+    {
+        double expected = (double)blocks * pi[i];
+        chi_square += ((double)v[i] - expected) * ((double)v[i] - expected) / expected;
+    }
+
+    return igamc(k / 2.0, chi_square / 2.0);
+}
+
+// Section 2.13, cumulative sums test in both directions from a single pass.
+static void cumulative_sums(const uint64_t* words, size_t bits, double* forward, double* reverse)
+{
+    long sum = 0;
+    long max = 0;
+    long min = 0;
+    long z = 0;
+    for (size_t i = 0; i < bits; i++)
+    {
+        sum += get_bit(words, i) ? 1 : -1;
+        if (labs(sum) > z)
+        {
+            z = labs(sum);
+        }
+        // The reverse walk's partial sums are sum(n) - sum(k) for k < n.
+        if (i + 1 < bits)
+        {
+            max = sum > max ? sum : max;
+            min = sum < min ? sum : min;
+        }
+    }
+
+    long z_reverse = labs(sum - min) > labs(sum - max) ? labs(sum - min) : labs(sum - max);
+    *forward = cusum_p((long)bits, z);
+    *reverse = cusum_p((long)bits, z_reverse);
+}
+
+static double cusum_p(long n, long z)
+{
+    double root_n = sqrt((double)n);
+    double sum1 = 0.0;
+    for (long k = (-n / z + 1) / 4; k <= (n / z - 1) / 4; k++)
+    {
+        sum1 += normal((double)((4 * k + 1) * z) / root_n) - normal((double)((4 * k - 1) * z) / root_n);
+    }
+
+    double sum2 = 0.0;
+    for (long k = (-n / z - 3) / 4; k <= (n / z - 1) / 4; k++)
+    {
+        sum2 += normal((double)((4 * k + 3) * z) / root_n) - normal((double)((4 * k + 1) * z) / root_n);
+    }
+
+    return 1.0 - sum1 + sum2;
+}
+
+// Section 2.12, approximate entropy test with overlapping patterns wrapping around the sequence.
+static double approximate_entropy(const uint64_t* words, size_t bits)
+{
+    enum { m = APPROXIMATE_ENTROPY_M };
+    static_assert(m < 16, "pattern counts are indexed by 16 bit values");
+
+    uint32_t* counts = calloc((1u << m) + (1u << (m + 1)), sizeof(uint32_t));
+    if (counts == NULL)
+    {
+        return NAN;
+    }
+    uint32_t* counts_m = counts;
+    uint32_t* counts_m1 = counts + (1u << m);
+
+    // Each m + 1 bit pattern starting at i also gives the m bit pattern starting at i.
+    unsigned pattern = 0;
+    for (size_t i = 0; i < m; i++)
+    {
+        pattern = pattern << 1 | get_bit(words, i);
+    }
+    for (size_t i = 0; i < bits; i++)
+    {
+        size_t next = i + m < bits ? i + m : i + m - bits;
+        pattern = (pattern << 1 | get_bit(words, next)) & ((1u << (m + 1)) - 1);
+        ++counts_m1[pattern];
+        ++counts_m[pattern >> 1];
+    }
+
+    double n = (double)bits;
+    double phi_m = 0.0;
+    double phi_m1 = 0.0;
+    for (unsigned i = 0; i < (1u << (m + 1)); i++)
+    {
+        if (i < (1u << m) && counts_m[i] > 0)
+        {
+            phi_m += counts_m[i] / n * log(counts_m[i] / n);
+        }
+        if (counts_m1[i] > 0)
+        {
+            phi_m1 += counts_m1[i] / n * log(counts_m1[i] / n);
+        }
+    }
+    free(counts);
+
+    double chi_square = 2.0 * n * (log(2.0) - (phi_m - phi_m1));
+    return igamc((double)(1u << (m - 1)), chi_square / 2.0);
+}
+
+/*
+ * Section 4.2, the proportion of sequences passing each test must fall
+ * within three standard deviations of 1 - alpha, and the p-values must be
+ * uniformly distributed over ten bins.
+ */
+static bool report(const device_t* dev, const job_t* jobs, size_t count, size_t bits)
+{
+    printf("device %s: %zu sequences", dev->name, count);
+    if (dev->skipped > 0)
+    {
+        printf(", %zu failed or corrupt records skipped", dev->skipped);
+    }
+    printf("\n");
+
+    if (count == 0)
+    {
+        printf("  not enough data for a %zu bit sequence\n\n", bits);
+        return false;
+    }
+
+    printf("  %-20s %13s %11s %11s %11s\n", "test", "passed", "proportion", "minimum", "uniformity");
+
+    bool passed = true;
+    for (int test = 0; test < TEST_COUNT; test++)
+    {
+        size_t applicable = 0;
+        size_t pass = 0;
+        size_t bins[10] = { 0 };
+        for (size_t i = 0; i < count; i++)
+        {
+            double p = jobs[i].p[test];
+            if (isnan(p))
+            {
+                continue;
+            }
+
+            ++applicable;
+            pass += p >= ALPHA;
+            ++bins[p >= 1.0 ? 9 : (size_t)(p * 10.0)];
+        }
+
+        if (applicable == 0)
+        {
+            printf("  %-20s %13s\n", test_names[test], "n/a");
+            continue;
+        }
+
+        double proportion = (double)pass / (double)applicable;
+        double minimum = (1.0 - ALPHA) - 3.0 * sqrt(ALPHA * (1.0 - ALPHA) / (double)applicable);
+        bool ok = proportion >= minimum;
+
+        char counts[32];
+        snprintf(counts, sizeof(counts), "%zu/%zu", pass, applicable);
+        printf("  %-20s %13s %11.4f %11.4f", test_names[test], counts, proportion, minimum);
+
+        if (applicable >= UNIFORMITY_MIN_SEQUENCES)
+        {
+            double expected = (double)applicable / 10.0;
+            double chi_square = 0.0;
+            for (int bin = 0; bin < 10; bin++)
+            {
+                chi_square += ((double)bins[bin] - expected) * ((double)bins[bin] - expected) / expected;
+            }
+
+            double uniformity = igamc(9.0 / 2.0, chi_square / 2.0);
+            ok &= uniformity >= UNIFORMITY_ALPHA;
+            printf(" %11.6f", uniformity);
+        }
+        else
+        {
+            printf(" %11s", "-");
+        }
+
+        printf("%s\n", ok ? "" : "  FAIL");
+        passed &= ok;
+    }
+
+    printf("\n");
+    return passed;
+}
+
+// Upper regularized incomplete gamma function Q(a, x).
+static double igamc(double a, double x)
+{
+    if (x <= 0.0)
+    {
+        return 1.0;
+    }
+
+    double log_prefix = a * log(x) - x - lgamma(a);
+
+    // Series for P(a, x) converges quickly below a + 1.
+    if (x < a + 1.0)
+    {
+        double term = 1.0 / a;
+        double sum = term;
+        for (int n = 1; n < 1000 && fabs(term) > fabs(sum) * 1e-15; n++)
+        {
+            term *= x / (a + n);
+            sum += term;
+        }
+        return 1.0 - sum * exp(log_prefix);
+    }
+
+    // Lentz's method for the continued fraction of Q(a, x) otherwise.
+    double b = x + 1.0 - a;
+    double c = 1.0 / 1e-300;
+    double d = 1.0 / b;
+    double h = d;
+    for (int n = 1; n < 1000; n++)
+    {
+        double an = -n * (n - a);
+        b += 2.0;
+        d = an * d + b;
+        d = fabs(d) < 1e-300 ? 1e-300 : d;
+        c = b + an / c;
+        c = fabs(c) < 1e-300 ? 1e-300 : c;
+        d = 1.0 / d;
+        double delta = d * c;
+        h *= delta;
+        if (fabs(delta - 1.0) < 1e-15)
+        {
+            break;
+        }
+    }
+    return h * exp(log_prefix);
+}
+
+// Standard normal cumulative distribution function.
+static double normal(double x)
+{
+    return 0.5 * erfc(-x / sqrt(2.0));
+}
@@ -0,0 +1,38 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef RNG90_TESTS_CHECK_H
+#define RNG90_TESTS_CHECK_H
+
+#include <stdio.h>
+
+/*
+ * Minimal assertions for the host tests, a failed check is reported and
+ * counted so one run shows every failure, main returns CHECK_RESULT().
+ */
+
+static int check_failures;
+
+#define CHECK(condition) do { \
+    if (!(condition)) { \
+        fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+        ++check_failures; \
+    } \
+} while (0)
+
+#define CHECK_RESULT() (check_failures == 0 ? 0 : 1)
+
+#endif // RNG90_TESTS_CHECK_H
@@ -0,0 +1,124 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Known answers for the table driven CRC-16, checked against the frames the
+ * driver sends, the wake response from the datasheet and a bit at a time
+ * reference written directly from the polynomial.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "check.h"
+#include "rng90/crc.h"
+#include "rng90/frames.h"
+
+// Internal Function Definitions
+static uint16_t reference_crc16(const uint8_t* data, size_t length);
+
+int main(void)
+{
+    // Frames as written to the bus, the CRC covers everything after the word address.
+    static const uint8_t info[] = RNG90_FRAME_INFO;
+    static const uint8_t random[] = RNG90_FRAME_RANDOM;
+    static const uint8_t read_serial[] = RNG90_FRAME_READ_SERIAL;
+
+    CHECK(rng90_crc16(&info[1], RNG90_FRAME_INFO_SIZE - 3) == 0x5D03);
+    CHECK(rng90_crc16(&random[1], RNG90_FRAME_RANDOM_SIZE - 3) == 0xE07D);
+    CHECK(rng90_crc16(&read_serial[1], RNG90_FRAME_READ_SERIAL_SIZE - 3) == 0xA71D);
+    CHECK(rng90_crc16_check_frame(&info[1]));
+    CHECK(rng90_crc16_check_frame(&random[1]));
+    CHECK(rng90_crc16_check_frame(&read_serial[1]));
+
+    // Wake response, status 0x11.
+    static const uint8_t wake[] = { 0x04, 0x11, 0x33, 0x43 };
+    CHECK(rng90_crc16_check_frame(wake));
+
+    static const uint8_t empty[] = { 0x00 };
+    CHECK(rng90_crc16(empty, 0) == 0x0000);
+
+    // Every length a frame can have, whole and split across incremental updates.
+    srand(1);
+    uint8_t data[255];
+    for (size_t length = 0; length <= sizeof(data); length++)
+    {
+        for (size_t i = 0; i < length; i++)
+        {
+            data[i] = (uint8_t)rand();
+        }
+
+        uint16_t expected = reference_crc16(data, length);
+        CHECK(rng90_crc16(data, (uint8_t)length) == expected);
+
+        size_t split = length ? (size_t)rand() % length : 0;
+        rng90_crc16_context_t ctx;
+        rng90_crc16_init(&ctx);
+        rng90_crc16_update(&ctx, data, split);
+        rng90_crc16_update(&ctx, &data[split], length - split);
+        CHECK(rng90_crc16_final(&ctx) == expected);
+    }
+
+    // Batch validation, every third frame corrupted.
+    uint8_t frames[10][8];
+    const uint8_t* frame_ptrs[10];
+    for (size_t i = 0; i < 10; i++)
+    {
+        memcpy(frames[i], &read_serial[1], 7);
+        frames[i][2] = (uint8_t)i;
+        uint16_t crc = reference_crc16(frames[i], 5);
+        frames[i][5] = (uint8_t)(crc & 0xFF);
+        frames[i][6] = (uint8_t)(crc >> 8);
+        if (i % 3 == 0)
+        {
+            frames[i][3] ^= 0x01;
+        }
+        frame_ptrs[i] = frames[i];
+    }
+
+    uint8_t bitmap[2];
+    CHECK(rng90_crc16_check_frames(frame_ptrs, 10, bitmap) == 6);
+    CHECK(bitmap[0] == 0xB6);
+    CHECK(bitmap[1] == 0x01);
+
+    return CHECK_RESULT();
+}
+
+// Internal function implementations
+
+/*
+ * CRC-16 with polynomial 0x8005, each input byte reflected and the remainder
+ * not reflected, one bit at a time.
+ */
+static uint16_t reference_crc16(const uint8_t* data, size_t length)
+{
+    uint16_t crc = 0x0000;
+    for (size_t pos = 0; pos < length; pos++)
+    {
+        for (int bit = 0; bit < 8; bit++)
+        {
+            unsigned in = (data[pos] >> bit) & 1;
+            unsigned top = (crc >> 15) & 1;
+            crc = (uint16_t)(crc << 1);
+            if (in ^ top)
+            {
+                crc ^= 0x8005;
+            }
+        }
+    }
+
+    return crc;
+}
@@ -0,0 +1,107 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Checks the fused CRC check and copy used for Random responses, the copy
+ * must only be kept when the CRC matches and must agree with a separate
+ * check followed by a copy.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "check.h"
+#include "rng90/crc.h"
+
+#define RESPONSE_SIZE 35
+#define DATA_SIZE 32
+
+// Internal Function Definitions
+static void make_response(uint8_t* frame);
+
+int main(void)
+{
+    uint8_t frame[RESPONSE_SIZE];
+    uint8_t dest[DATA_SIZE + 1];
+
+    srand(1);
+    make_response(frame);
+
+    // A valid response is copied whole.
+    memset(dest, 0xAA, sizeof(dest));
+    CHECK(rng90_crc16_check_frame_copy(frame, dest, DATA_SIZE));
+    CHECK(memcmp(dest, &frame[1], DATA_SIZE) == 0);
+    CHECK(dest[DATA_SIZE] == 0xAA);
+
+    // A shorter copy leaves the rest of the destination alone.
+    memset(dest, 0xAA, sizeof(dest));
+    CHECK(rng90_crc16_check_frame_copy(frame, dest, 16));
+    CHECK(memcmp(dest, &frame[1], 16) == 0);
+    CHECK(dest[16] == 0xAA);
+
+    // Any corrupted byte, count, data or CRC, zeroes the destination.
+    uint8_t zero[DATA_SIZE] = { 0 };
+    for (size_t pos = 1; pos < RESPONSE_SIZE; pos++)
+    {
+        frame[pos] ^= 0x40;
+        memset(dest, 0xAA, sizeof(dest));
+        CHECK(!rng90_crc16_check_frame_copy(frame, dest, DATA_SIZE));
+        CHECK(memcmp(dest, zero, DATA_SIZE) == 0);
+        CHECK(dest[DATA_SIZE] == 0xAA);
+        frame[pos] ^= 0x40;
+    }
+
+    // Too short to hold a CRC, or to fill the destination.
+    static const uint8_t wake[] = { 0x04, 0x11, 0x33, 0x43 };
+    static const uint8_t truncated[] = { 0x02, 0x00 };
+    memset(dest, 0xAA, sizeof(dest));
+    CHECK(!rng90_crc16_check_frame_copy(wake, dest, 2));
+    CHECK(dest[0] == 0x00 && dest[1] == 0x00);
+    CHECK(rng90_crc16_check_frame_copy(wake, dest, 1));
+    CHECK(dest[0] == 0x11);
+    CHECK(!rng90_crc16_check_frame_copy(truncated, dest, 0));
+
+    // Agrees with a separate check on random frames, a quarter of them corrupted.
+    for (int i = 0; i < 1000; i++)
+    {
+        make_response(frame);
+        if (rand() % 4 == 0)
+        {
+            frame[1 + rand() % (RESPONSE_SIZE - 1)] ^= (uint8_t)(1 + rand() % 255);
+        }
+
+        bool valid = rng90_crc16_check_frame(frame);
+        CHECK(rng90_crc16_check_frame_copy(frame, dest, DATA_SIZE) == valid);
+        CHECK(memcmp(dest, valid ? &frame[1] : zero, DATA_SIZE) == 0);
+    }
+
+    return CHECK_RESULT();
+}
+
+// Internal function implementations
+
+static void make_response(uint8_t* frame)
+{
+    frame[0] = RESPONSE_SIZE;
+    for (size_t i = 1; i <= DATA_SIZE; i++)
+    {
+        frame[i] = (uint8_t)rand();
+    }
+
+    crc_t crc = rng90_crc16(frame, DATA_SIZE + 1);
+    frame[DATA_SIZE + 1] = (uint8_t)(crc & 0xFF);
+    frame[DATA_SIZE + 2] = (uint8_t)(crc >> 8);
+}
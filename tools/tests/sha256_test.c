@@ -0,0 +1,95 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+/*
+ * SHA-256 known answers from FIPS 180-2 appendix B, plus the empty message,
+ * each hashed whole and fed in uneven pieces to cover the block buffering.
+ */
+
+#include <string.h>
+
+#include "check.h"
+#include "rng90/sha256.h"
+
+struct vector {
+    const char* message;
+    size_t repeat;
+    uint8_t digest[RNG90_SHA256_DIGEST_SIZE];
+};
+
+static const struct vector vectors[] = {
+    { "", 1, {
+        0xe3, 0xb0, 0xc4, 0x42, 0x98, 0xfc, 0x1c, 0x14, 0x9a, 0xfb, 0xf4, 0xc8, 0x99, 0x6f, 0xb9, 0x24,
+        0x27, 0xae, 0x41, 0xe4, 0x64, 0x9b, 0x93, 0x4c, 0xa4, 0x95, 0x99, 0x1b, 0x78, 0x52, 0xb8, 0x55 } },
+    { "abc", 1, {
+        0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+        0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad } },
+    { "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq", 1, {
+        0x24, 0x8d, 0x6a, 0x61, 0xd2, 0x06, 0x38, 0xb8, 0xe5, 0xc0, 0x26, 0x93, 0x0c, 0x3e, 0x60, 0x39,
+        0xa3, 0x3c, 0xe4, 0x59, 0x64, 0xff, 0x21, 0x67, 0xf6, 0xec, 0xed, 0xd4, 0x19, 0xdb, 0x06, 0xc1 } },
+    { "a", 1000000, {
+        0xcd, 0xc7, 0x6e, 0x5c, 0x99, 0x14, 0xfb, 0x92, 0x81, 0xa1, 0xc7, 0xe2, 0x84, 0xd7, 0x3e, 0x67,
+        0xf1, 0x80, 0x9a, 0x48, 0xa4, 0x97, 0x20, 0x0e, 0x04, 0x6d, 0x39, 0xcc, 0xc7, 0x11, 0x2c, 0xd0 } },
+};
+
+int main(void)
+{
+    for (size_t v = 0; v < sizeof(vectors) / sizeof(vectors[0]); v++)
+    {
+        const struct vector* vector = &vectors[v];
+        size_t length = strlen(vector->message);
+        uint8_t digest[RNG90_SHA256_DIGEST_SIZE];
+
+        rng90_sha256_context_t ctx;
+        rng90_sha256_init(&ctx);
+        for (size_t r = 0; r < vector->repeat; r++)
+        {
+            rng90_sha256_update(&ctx, (const uint8_t*)vector->message, length);
+        }
+        rng90_sha256_final(&ctx, digest);
+        CHECK(memcmp(digest, vector->digest, sizeof(digest)) == 0);
+
+        // Piecewise, the pieces growing so they land either side of block boundaries.
+        if (vector->repeat == 1)
+        {
+            rng90_sha256_init(&ctx);
+            size_t pos = 0;
+            for (size_t piece = 1; pos < length; piece++)
+            {
+                size_t n = piece < length - pos ? piece : length - pos;
+                rng90_sha256_update(&ctx, (const uint8_t*)&vector->message[pos], n);
+                pos += n;
+            }
+            rng90_sha256_final(&ctx, digest);
+            CHECK(memcmp(digest, vector->digest, sizeof(digest)) == 0);
+        }
+    }
+
+    // The million a's again as 1000 byte updates, crossing block boundaries at every offset.
+    static uint8_t thousand[1000];
+    memset(thousand, 'a', sizeof(thousand));
+    uint8_t digest[RNG90_SHA256_DIGEST_SIZE];
+    rng90_sha256_context_t ctx;
+    rng90_sha256_init(&ctx);
+    for (int i = 0; i < 1000; i++)
+    {
+        rng90_sha256_update(&ctx, thousand, sizeof(thousand));
+    }
+    rng90_sha256_final(&ctx, digest);
+    CHECK(memcmp(digest, vectors[3].digest, sizeof(digest)) == 0);
+
+    return CHECK_RESULT();
+}
@@ -0,0 +1,48 @@
+/* Copyright 2025, Darran A Lofthouse
+ *
+ * This file is part of pico-rng90.
+ *
+ * pico-rng90 is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation, either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * pico-rng90 is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with pico-rng90.
+ * If  not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <stdint.h>
+
+#include "rng90/wipe.h"
+#include "rng90_hot.h"
+
+void RNG90_HOT_FUNC(rng90_secure_wipe)(void* data, size_t length)
+{
+    /*
+     * Every store is through a volatile pointer so none of them can be
+     * treated as dead stores and optimised away.
+     */
+    volatile uint8_t* bytes = (volatile uint8_t*)data;
+    while (length > 0 && ((uintptr_t)bytes & 0x03))
+    {
+        *bytes++ = 0x00;
+        --length;
+    }
+
+    volatile uint32_t* words = (volatile uint32_t*)bytes;
+    while (length >= 4)
+    {
+        *words++ = 0x00000000;
+        length -= 4;
+    }
+
+    bytes = (volatile uint8_t*)words;
+    while (length > 0)
+    {
+        *bytes++ = 0x00;
+        --length;
+    }
+}